@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_INTERFACE_SPI_QUEUE_HPP
+#define MODM_INTERFACE_SPI_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <modm/processing/resumable.hpp>
+#include "spi.hpp"
+
+namespace modm
+{
+
+/**
+ * Descriptor of a single SPI transfer executed by a `modm::SpiQueue`.
+ *
+ * The descriptor is owned by the driver and linked into the queue without
+ * copying, so it and its buffers must stay valid until `isBusy()` returns
+ * `false` again.
+ *
+ * @ingroup	modm_architecture_spi_queue
+ */
+class SpiTransaction
+{
+	template< class SpiMaster >
+	friend class SpiQueue;
+
+public:
+	/// Called with `true` before and with `false` after the transfer
+	using ChipSelect = void(*)(bool select);
+
+	/**
+	 * @param	tx		transmit buffer, `nullptr` to send dummy bytes
+	 * @param	rx		receive buffer, `nullptr` to discard received bytes
+	 * @param	length	number of bytes to be shifted out
+	 * @param	chipSelect	selects the slave, `nullptr` if not needed
+	 * @param	configuration	applied to the master before the transfer,
+	 * 					`nullptr` to keep the current configuration
+	 */
+	SpiTransaction(const uint8_t *tx = nullptr, uint8_t *rx = nullptr,
+				   std::size_t length = 0, ChipSelect chipSelect = nullptr,
+				   Spi::ConfigurationHandler configuration = nullptr)
+	:	tx(tx), rx(rx), length(length),
+		chipSelect(chipSelect), configuration(configuration)
+	{
+	}
+
+	/// Chip select for an active-low GPIO `Cs`.
+	template< class Cs >
+	static void
+	select(bool select)
+	{
+		Cs::set(not select);
+	}
+
+	/// Changes the buffers, which is only permitted while not busy.
+	void inline
+	setBuffers(const uint8_t *tx, uint8_t *rx, std::size_t length)
+	{
+		this->tx = tx;
+		this->rx = rx;
+		this->length = length;
+	}
+
+	/// @return `true` while the transaction is queued or transferring
+	bool inline
+	isBusy() const
+	{
+		return busy;
+	}
+
+private:
+	const uint8_t *tx;
+	uint8_t *rx;
+	std::size_t length;
+	ChipSelect chipSelect;
+	Spi::ConfigurationHandler configuration;
+
+	SpiTransaction *next{nullptr};
+	bool busy{false};
+};
+
+/**
+ * Submission queue of SPI transactions.
+ *
+ * Device drivers submit transactions, for example a batch of register
+ * reads from several sensors, instead of acquiring the master and
+ * transferring themselves. `execute()` then acquires the master once and
+ * runs all transactions back-to-back, so that the bus is not idle while
+ * each driver waits to be scheduled again.
+ *
+ * Consecutive transactions with the same or no configuration handler share
+ * one acquisition of the master. A different handler releases the master
+ * and acquires it again with the new configuration.
+ *
+ * @code
+ * modm::SpiQueue<SpiMaster1> queue;
+ * modm::SpiTransaction reads[12];
+ *
+ * for (auto &read : reads) queue.submit(read);
+ * RF_CALL(queue.execute());
+ * @endcode
+ *
+ * @warning	`execute()` must only be called from one context.
+ *
+ * @tparam	SpiMaster	SPI master executing the transactions
+ * @ingroup	modm_architecture_spi_queue
+ */
+template< class SpiMaster >
+class SpiQueue : protected modm::NestedResumable<1>
+{
+public:
+	/**
+	 * Appends a transaction to the queue.
+	 *
+	 * @return	`false` if the transaction is already busy
+	 */
+	bool
+	submit(SpiTransaction &transaction)
+	{
+		if (transaction.busy) return false;
+
+		transaction.busy = true;
+		transaction.next = nullptr;
+		if (tail) tail->next = &transaction;
+		else head = &transaction;
+		tail = &transaction;
+		return true;
+	}
+
+	/// @return `true` if no transactions are waiting
+	bool inline
+	isEmpty() const
+	{
+		return head == nullptr;
+	}
+
+	/**
+	 * Executes all queued transactions in order, including the ones
+	 * submitted while executing, and returns when the queue is empty.
+	 */
+	modm::ResumableResult<void>
+	execute();
+
+private:
+	SpiTransaction*
+	pop()
+	{
+		SpiTransaction *transaction = head;
+		head = head->next;
+		if (head == nullptr) tail = nullptr;
+		return transaction;
+	}
+
+	SpiTransaction *head{nullptr};
+	SpiTransaction *tail{nullptr};
+	SpiTransaction *current{nullptr};
+	Spi::ConfigurationHandler configuration{nullptr};
+};
+
+}	// namespace modm
+
+template< class SpiMaster >
+modm::ResumableResult<void>
+modm::SpiQueue<SpiMaster>::execute()
+{
+	RF_BEGIN();
+
+	while (head)
+	{
+		RF_WAIT_UNTIL(SpiMaster::acquire(this, head->configuration));
+		configuration = head->configuration;
+
+		while (head and (head->configuration == nullptr or
+						 head->configuration == configuration))
+		{
+			current = pop();
+			if (current->chipSelect) current->chipSelect(true);
+
+			RF_CALL(SpiMaster::transfer(current->tx, current->rx, current->length));
+
+			if (current->chipSelect) current->chipSelect(false);
+			current->busy = false;
+		}
+
+		SpiMaster::release(this);
+	}
+
+	RF_END();
+}
+
+#endif // MODM_INTERFACE_SPI_QUEUE_HPP
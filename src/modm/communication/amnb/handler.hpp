@@ -26,6 +26,11 @@
 
 namespace modm::amnb
 {
+
+/// @cond
+namespace detail { template< size_t > class CommandIndex; }
+/// @endcond
+
 /// @ingroup modm_communication_amnb
 /// @{
 
@@ -84,7 +89,8 @@ protected:
 	Storage callback;
 	Redirect *const redirect;
 	inline void call(const Message &msg) { redirect(msg, &callback); }
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
+	template< size_t > friend class detail::CommandIndex;
 };
 
 struct Response
@@ -208,7 +214,8 @@ protected:
 	Redirect *const redirect;
 
 	inline Message call(const Message &msg) { return redirect(msg, &callback); }
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
+	template< size_t > friend class detail::CommandIndex;
 };
 
 template< class ReturnType = void, class ErrorType = void >
@@ -265,7 +272,7 @@ protected:
 	};
 	Error syserr{Error::Ok};
 
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 
 /// @cond
@@ -318,7 +325,7 @@ protected:
 	const ReturnType *retval{nullptr};
 	Error syserr{Error::Ok};
 
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 
 template<>
@@ -364,7 +371,7 @@ protected:
 	}
 	Error syserr{Error::Ok};
 
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 /// @endcond
 /// @}
@@ -15,26 +15,122 @@
 #include "handler.hpp"
 #include <modm/processing.hpp>
 #include <modm/container.hpp>
+#include <algorithm>
 
 namespace modm::amnb
 {
 
-/// @author	Niklas Hauser
-/// @ingroup modm_communication_amnb
-template < size_t TxBufferSize = 2, size_t MaxHeapAllocation = 0 >
+/// @cond
+namespace detail
+{
+
+/// Linear search through the handler list, which needs no memory
+template< size_t Size >
+class CommandIndex
+{
+public:
+	template< class Handler >
+	void
+	initialize(const Handler *, uint8_t) {}
+
+	/// @returns the position of the first handler with the command at or
+	///			 after the position `from`, otherwise `count`
+	template< class Handler >
+	uint8_t
+	find(const Handler *list, uint8_t count, uint8_t command, uint8_t from = 0) const
+	{
+		for (; from < count; from++)
+			if (list[from].command == command) break;
+		return from;
+	}
+
+	template< class Handler >
+	Handler&
+	get(Handler *list, uint8_t position) const
+	{ return list[position]; }
+};
+
+/// Index over the commands of a handler list with up to `Size` handlers
+///
+/// Keeps a permutation of the list sorted by command, so that handlers are
+/// found by binary search regardless of the order of the list. Handlers with
+/// the same command stay in the order of the list.
+template< size_t Size > requires (Size > 0)
+class CommandIndex<Size>
+{
+public:
+	template< class Handler >
+	void
+	initialize(const Handler *list, uint8_t count)
+	{
+		std::fill(std::begin(map), std::end(map), 0);
+		for (uint8_t ii = 0; ii < count; ii++)
+		{
+			map[list[ii].command >> 3] |= 1u << (list[ii].command & 0x7);
+			// stable insertion sort, which does not allocate
+			uint8_t position = ii;
+			for (; position and list[order[position - 1]].command > list[ii].command; position--)
+				order[position] = order[position - 1];
+			order[position] = ii;
+		}
+	}
+
+	bool
+	contains(uint8_t command) const
+	{ return map[command >> 3] & (1u << (command & 0x7)); }
+
+	/// @returns the position of the first handler with the command at or
+	///			 after the position `from` in the sorted order, otherwise `count`
+	template< class Handler >
+	uint8_t
+	find(const Handler *list, uint8_t count, uint8_t command, uint8_t from = 0) const
+	{
+		if (not contains(command)) return count;
+		if (from) return (from < count and list[order[from]].command == command) ? from : count;
+		const uint8_t *position = std::lower_bound(order, order + count, command,
+				[list](uint8_t index, uint8_t command) { return list[index].command < command; });
+		return position - order;
+	}
+
+	template< class Handler >
+	Handler&
+	get(Handler *list, uint8_t position) const
+	{ return list[order[position]]; }
+
+protected:
+	uint8_t map[256/8];
+	uint8_t order[Size];
+};
+
+}
+/// @endcond
+
+/**
+ * @tparam IndexSize	Maximum number of actions and of listeners that are
+ *						indexed by command to find them by binary search.
+ *						The index takes `32 + IndexSize` bytes per list. With
+ *						the default of zero the lists are searched linearly.
+ *
+ * @author	Niklas Hauser
+ * @ingroup modm_communication_amnb
+ */
+template < size_t TxBufferSize = 2, size_t MaxHeapAllocation = 0, size_t IndexSize = 0 >
 class Node : public modm::Resumable<6>
 {
 	static_assert(2 <= TxBufferSize, "TxBuffer must have at least two messages!");
+	static_assert(IndexSize <= 0xff, "IndexSize must be smaller than 256!");
 public:
 	Node(Device &device, uint8_t address): interface(device), address(address)
-	{ setSeed(); }
+	{ setSeed(); initializeIndex(); }
 
 	template< size_t Actions >
 	Node(Device &device, uint8_t address, Action (&actions)[Actions])
 	:	interface(device), actionList(actions), actionCount(Actions), address(address)
 	{
 		static_assert(Actions <= 0xff, "Actions list must be smaller than 255!");
+		static_assert(IndexSize == 0 or Actions <= IndexSize, "Actions list must fit into the IndexSize!");
 		setSeed();
+		initializeIndex();
 	}
 
 	template< size_t Listeners >
@@ -42,7 +138,9 @@ public:
 	:	interface(device), listenerList(listeners), listenerCount(Listeners), address(address)
 	{
 		static_assert(Listeners <= 0xff, "Listeners list must be smaller than 255!");
+		static_assert(IndexSize == 0 or Listeners <= IndexSize, "Listeners list must fit into the IndexSize!");
 		setSeed();
+		initializeIndex();
 	}
 
 	template< size_t Actions, size_t Listeners >
@@ -51,8 +149,11 @@ public:
 		actionCount(Actions), listenerCount(Listeners), address(address)
 	{
 		static_assert(Actions <= 0xff, "Actions list must be smaller than 255!");
+		static_assert(IndexSize == 0 or Actions <= IndexSize, "Actions list must fit into the IndexSize!");
 		static_assert(Listeners <= 0xff, "Listeners list must be smaller than 255!");
+		static_assert(IndexSize == 0 or Listeners <= IndexSize, "Listeners list must fit into the IndexSize!");
 		setSeed();
+		initializeIndex();
 	}
 
 	void
@@ -65,6 +166,18 @@ public:
 	setSeed(uint16_t seed)
 	{ lfsr = seed; }
 
+	/**
+	 * Handles all pending received messages in one call to `update()`
+	 * instead of yielding after every message.
+	 *
+	 * @warning The responses to requests are only sent on the next call to
+	 *          `update()`, so the TX buffer must be large enough for all
+	 *          requests that can be received in one batch.
+	 */
+	void
+	setBatching(bool enable)
+	{ batching = enable; }
+
 public:
 	bool
 	broadcast(uint8_t command)
@@ -217,6 +330,8 @@ protected:
 					// Only handle message *with* data if it's for us
 					if (is_rx_msg_for_us) handleRxMessage(true);
 				}
+				// Drain all pending messages without yielding in between
+				if (batching and interface.isMediumBusy()) continue;
 			}
 			RF_YIELD();
 		}
@@ -230,33 +345,33 @@ protected:
 		switch(rx_msg.type())
 		{
 			case Type::Broadcast:
-				for (size_t ii=0; ii<listenerCount; ii++)
+			{
+				const uint8_t command = rx_msg.command();
+				for (uint8_t position = listenerIndex.find(listenerList, listenerCount, command);
+					 position < listenerCount;
+					 position = listenerIndex.find(listenerList, listenerCount, command, position + 1))
 				{
-					auto& listener = listenerList[ii];
-					if (rx_msg.command() == listener.command) {
-						if (complete) listener.call(rx_msg);
-						else return true;
-					}
+					if (complete) listenerIndex.get(listenerList, position).call(rx_msg);
+					else return true;
 				}
 				break;
+			}
 
 			case Type::Request:
 				if (rx_msg.address() == address)
 				{
-					for (size_t ii=0; ii<actionCount; ii++)
+					if (const uint8_t position = actionIndex.find(actionList, actionCount, rx_msg.command());
+						position < actionCount)
 					{
-						auto& action = actionList[ii];
-						if (rx_msg.command() == action.command)
+						if (complete)
 						{
-							if (complete)
-							{
-								auto msg = action.call(rx_msg);
-								msg.setAddress(address);
-								msg.setCommand(action.command);
-								tx_queue.push(std::move(msg));
-							}
-							return true;
+							Action &action = actionIndex.get(actionList, position);
+							auto msg = action.call(rx_msg);
+							msg.setAddress(address);
+							msg.setCommand(action.command);
+							tx_queue.push(std::move(msg));
 						}
+						return true;
 					}
 					Message msg(address, rx_msg.command(), 1, Type::Error);
 					*msg.get<Error>() = Error::NoAction;
@@ -284,6 +399,13 @@ protected:
 	setSeed()
 	{ lfsr = address << 8 | (address + 1); }
 
+	void
+	initializeIndex()
+	{
+		actionIndex.initialize(actionList, actionCount);
+		listenerIndex.initialize(listenerList, listenerCount);
+	}
+
 	void
 	reschedule(uint8_t mask)
 	{
@@ -301,6 +423,8 @@ protected:
 
 	Action *const actionList{nullptr};
 	Listener *const listenerList{nullptr};
+	detail::CommandIndex<IndexSize> actionIndex;
+	detail::CommandIndex<IndexSize> listenerIndex;
 
 	modm::ShortPreciseTimeout tx_timer;
 	modm::ShortTimeout response_timer;
@@ -316,6 +440,7 @@ protected:
 
 	uint8_t tx_counter;
 	bool is_rx_msg_for_us;
+	bool batching{false};
 
 	enum class ResponseStatus : uint8_t
 	{
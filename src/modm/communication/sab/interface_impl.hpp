@@ -16,10 +16,6 @@
 	#error	"Don't include this file directly, use 'interface.hpp' instead!"
 #endif
 
-#ifdef __AVR__
-	#include <util/crc16.h>
-#endif
-
 /*#include <modm/debug/logger.hpp>
 
 #undef MODM_LOG_LEVEL
@@ -13,30 +13,11 @@
  */
 // ----------------------------------------------------------------------------
 
-#ifdef __AVR__
-#	include <util/crc16.h>
-#endif
-
 #include "interface.hpp"
+#include <modm/math/utils/crc.hpp>
 
 uint16_t
 modm::sab2::crcUpdate(uint16_t crc, uint8_t data)
 {
-#ifdef __AVR__
-	return _crc16_update(crc, data);
-#else
-	crc ^= data;
-	for (uint_fast8_t i = 0; i < 8; ++i)
-	{
-		if (crc & 1) {
-			crc = (crc >> 1) ^ 0xA001;
-		}
-		else {
-			crc = (crc >> 1);
-		}
-	}
-
-	return crc;
-#endif
+	return modm::math::Crc16Modbus::update(crc, data);
 }
-
@@ -30,7 +30,8 @@ namespace xpcc
 	 *
 	 * This class give to components an interface to xpcc communication, but
 	 * effectively it forwards all requests to the internal created Communicator,
-	 * which is bound to this AbstractComponent.
+	 * which is bound to this AbstractComponent. The sending functions return
+	 * \c false if the message was dropped, see xpcc::Communicator.
 	 *
 	 * TODO why do we use the communicator here?
 	 *
@@ -83,43 +84,43 @@ namespace xpcc
 		getCommunicator();
 
 	protected:
-		inline void
+		inline bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier);
 
-		inline void
+		inline bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier,
 				ResponseCallback& responseCallback);
 
 		template<typename T>
-		inline void
+		inline bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier, const T& data);
 
 		template<typename T>
-		inline void
+		inline bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier, const T& data,
 				ResponseCallback& responseCallback);
 
 
-		inline void
+		inline bool
 		publishEvent(uint8_t eventIdentifier);
 
 		template<typename T>
-		inline void
+		inline bool
 		publishEvent(uint8_t eventIdentifier, const T& data);
 
 
-		inline void
+		inline bool
 		sendResponse(const ResponseHandle& handle);
 
 		template<typename T>
-		inline void
+		inline bool
 		sendResponse(const ResponseHandle& handle, const T& data);
 
 		template<typename T>
-		inline void
+		inline bool
 		sendNegativeResponse(const ResponseHandle& handle, const T& data);
 
-		inline void
+		inline bool
 		sendNegativeResponse(const ResponseHandle& handle);
 
 		/*inline operator xpcc::Communicator* ()
@@ -24,74 +24,74 @@ xpcc::AbstractComponent::getCommunicator()
 }
 
 // ----------------------------------------------------------------------------
-void
+bool
 xpcc::AbstractComponent::callAction(uint8_t receiver, uint8_t actionIdentifier)
 {
-	this->communicator.callAction(receiver, actionIdentifier);
+	return this->communicator.callAction(receiver, actionIdentifier);
 }
 
-void
+bool
 xpcc::AbstractComponent::callAction(uint8_t receiver, uint8_t actionIdentifier, ResponseCallback& responseCallback)
 {
-	this->communicator.callAction(receiver, actionIdentifier, responseCallback);
+	return this->communicator.callAction(receiver, actionIdentifier, responseCallback);
 }
 
 
 // ----------------------------------------------------------------------------
-void
+bool
 xpcc::AbstractComponent::publishEvent(uint8_t eventIdentifier)
 {
-	this->communicator.publishEvent(eventIdentifier);
+	return this->communicator.publishEvent(eventIdentifier);
 }
 
 // ----------------------------------------------------------------------------
 template<typename T>
-void
+bool
 xpcc::AbstractComponent::callAction(uint8_t receiver,
 		uint8_t actionIdentifier, const T& data)
 {
-	this->communicator.callAction(receiver, actionIdentifier, data);
+	return this->communicator.callAction(receiver, actionIdentifier, data);
 }
 
 template<typename T>
-void
+bool
 xpcc::AbstractComponent::callAction(uint8_t receiver, uint8_t actionIdentifier,
 		const T& data, ResponseCallback& responseCallback)
 {
-	this->communicator.callAction(receiver, actionIdentifier, data, responseCallback);
+	return this->communicator.callAction(receiver, actionIdentifier, data, responseCallback);
 }
 
 // ----------------------------------------------------------------------------
 template<typename T>
-void
+bool
 xpcc::AbstractComponent::publishEvent(uint8_t eventIdentifier, const T& data)
 {
-	communicator.publishEvent(eventIdentifier, data);
+	return communicator.publishEvent(eventIdentifier, data);
 }
 
 // ----------------------------------------------------------------------------
-void
+bool
 xpcc::AbstractComponent::sendResponse(const ResponseHandle& handle)
 {
-	this->communicator.sendResponse(handle);
+	return this->communicator.sendResponse(handle);
 }
 
 template<typename T>
-void
+bool
 xpcc::AbstractComponent::sendResponse(const ResponseHandle& handle, const T& data)
 {
-	this->communicator.sendResponse(handle, data);
+	return this->communicator.sendResponse(handle, data);
 }
 
-void
+bool
 xpcc::AbstractComponent::sendNegativeResponse(const ResponseHandle& handle)
 {
-	this->communicator.sendNegativeResponse(handle);
+	return this->communicator.sendNegativeResponse(handle);
 }
 
 template<typename T>
-void
+bool
 xpcc::AbstractComponent::sendNegativeResponse(const ResponseHandle& handle, const T& data)
 {
-	this->communicator.sendNegativeResponse(handle, data);
+	return this->communicator.sendNegativeResponse(handle, data);
 }
@@ -19,12 +19,16 @@
 
 #include <modm/math/utils/bit_operation.hpp>
 #include <modm/architecture/interface/can_message.hpp>
+#include <modm/debug/logger.hpp>
 
 // ----------------------------------------------------------------------------
 template<typename Driver>
 xpcc::CanConnector<Driver>::CanConnector(Driver *driver) :
-	canDriver(driver)
+	reassemblyAge(0), canDriver(driver)
 {
+	for (Reassembly& slot : this->reassembly) {
+		slot.receivedFragments = 0;
+	}
 }
 
 template<typename Driver>
@@ -59,6 +63,13 @@ template<typename Driver>
 void
 xpcc::CanConnector<Driver>::sendPacket(const Header &header, modm::SmartPointer payload)
 {
+	if (payload.getSize() > maxFragmentedSize) {
+		// the fragment index cannot address the rest of the payload
+		MODM_LOG_ERROR << MODM_FILE_INFO << "packet with " << payload.getSize()
+				<< " bytes exceeds " << maxFragmentedSize << " bytes, dropped" << modm::endl;
+		return;
+	}
+
 	bool successful = false;
 	bool fragmented = (payload.getSize() > 8);
 
@@ -129,48 +140,58 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 		return;
 	}
 
-	SendListItem& message = this->sendList.getFront();
-
-	uint8_t messageSize = message.payload.getSize();
-	if (messageSize > 8)
+	// send one fragment of each packet inside the window
+	typename SendList::iterator message = this->sendList.begin();
+	for (uint8_t ii = 0; ii < sendWindow && message != this->sendList.end(); ++ii)
 	{
-		// fragmented message
-		uint8_t data[8];
-
-		data[0] = message.fragmentIndex | (this->messageCounter & 0xf0);
-		data[1] = messageSize; 	// size of the complete message
-
 		bool sendFinished = true;
-		uint8_t offset = message.fragmentIndex * 6;
-		uint8_t fragmentSize = messageSize - offset;
-		if (fragmentSize > 6)
+		uint8_t messageSize = message->payload.getSize();
+		if (messageSize > 8)
 		{
-			fragmentSize = 6;
-			sendFinished = false;
-		}
-		// otherwise fragmentSize is smaller or equal to six, so the last
-		// fragment is about to be sent.
+			// fragmented message
+			uint8_t data[8];
 
-		memcpy(data + 2, message.payload.getPointer() + offset, fragmentSize);
+			// every packet gets its own message counter when its first
+			// fragment is sent, so that the receiver can tell them apart
+			const uint8_t counter = (message->fragmentIndex == 0) ?
+					(this->messageCounter & 0xf0) : message->counter;
 
-		if (sendMessage(message.identifier, data, fragmentSize + 2))
-		{
-			message.fragmentIndex++;
-			if (sendFinished)
+			data[0] = message->fragmentIndex | counter;
+			data[1] = messageSize; 	// size of the complete message
+
+			uint8_t offset = message->fragmentIndex * 6;
+			uint8_t fragmentSize = messageSize - offset;
+			if (fragmentSize > 6)
+			{
+				fragmentSize = 6;
+				sendFinished = false;
+			}
+			// otherwise fragmentSize is smaller or equal to six, so the last
+			// fragment is about to be sent.
+
+			memcpy(data + 2, message->payload.getPointer() + offset, fragmentSize);
+
+			if (!sendMessage(message->identifier, data, fragmentSize + 2)) {
+				// no free slot in the CAN controller
+				return;
+			}
+			if (message->fragmentIndex++ == 0)
 			{
-				// message was the last fragment
-				// => remove it from the list
-				this->sendList.removeFront();
+				message->counter = counter;
 				this->messageCounter += 0x10;
 			}
 		}
-	}
-	else
-	{
-		if (this->sendMessage(message.identifier, message.payload.getPointer(),
-				messageSize))
+		else if (!this->sendMessage(message->identifier,
+				message->payload.getPointer(), messageSize))
 		{
-			this->sendList.removeFront();
+			return;
+		}
+
+		if (sendFinished) {
+			message = this->sendList.remove(message);
+		}
+		else {
+			++message;
 		}
 	}
 }
@@ -202,12 +223,12 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 			// calculate the number of messages need to send messageSize-bytes
 			uint8_t numberOfFragments = this->getNumberOfFragments(messageSize);
 
-			if (message.length < 3 || messageSize > 48 ||
+			if (message.length < 3 || messageSize > maxReceiveSize ||
 					fragmentIndex >= numberOfFragments)
 			{
 				// illegal format:
 				//   fragmented messages need to have at least 3 byte payload,
-				// 	 the maximum size is 48 Bytes and the fragment number
+				// 	 the maximum size is configurable and the fragment number
 				//	 should not be higher than the number of fragments.
 				return false;
 			}
@@ -231,46 +252,33 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 				return false;
 			}
 
-			// Check if other parts of this message are already in the
-			// list of receiving messages.
-			typename ReceiveList::iterator packet = this->pendingMessages.begin();
-			for ( ; packet != this->pendingMessages.end(); ++packet)
-			{
-				if (packet->header == header &&
-					packet->counter == counter)
-				{
-					break;
-				}
-			}
-
-			if (packet == this->pendingMessages.end()) {
-				// message not found => first part of this message,
-				// prepend it to the list
-				this->pendingMessages.prepend(ReceiveListItem(messageSize, header, counter));
-				packet = this->pendingMessages.begin();
-			}
+			Reassembly& packet = this->getReassembly(header, counter, messageSize);
 
 			// create a marker for the currently received fragment and
 			// test if the fragment was already received
-			const uint8_t currentFragment = (1 << fragmentIndex);
-			if (currentFragment & packet->receivedFragments)
+			const uint16_t currentFragment = (1 << fragmentIndex);
+			if (currentFragment & packet.receivedFragments)
 			{
 				// error: received fragment twice -> most likely a new message -> delete the old one
 				//MODM_LOG_WARNING << "lost fragment" << modm::flush;
-				packet->receivedFragments = 0;
+				packet.receivedFragments = 0;
+				packet.age = this->reassemblyAge++;
 			}
-			packet->receivedFragments |= currentFragment;
+			packet.receivedFragments |= currentFragment;
 
-			std::memcpy(packet->payload.getPointer() + offset,
+			std::memcpy(packet.data + offset,
 					message.data + 2,
 					message.length - 2);
 
 			// test if this was the last segment, otherwise we have to wait
 			// for more messages
-			if (modm::bitCount(packet->receivedFragments) == numberOfFragments)
+			if (packet.receivedFragments == ((1u << numberOfFragments) - 1))
 			{
-				this->receivedMessages.append(*packet);
-				this->pendingMessages.remove(packet);
+				this->receivedMessages.append(ReceiveListItem(messageSize, header));
+				std::memcpy(this->receivedMessages.getBack().payload.getPointer(),
+						packet.data,
+						messageSize);
+				packet.receivedFragments = 0;
 			}
 		}
 
@@ -280,3 +288,50 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 		return false;
 	}
 }
+
+template<typename Driver>
+typename xpcc::CanConnector<Driver>::Reassembly&
+xpcc::CanConnector<Driver>::getReassembly(const Header& header,
+		uint8_t counter, uint8_t size)
+{
+	const uint8_t start = (header.source ^ (counter >> 4)) % reassemblySlots;
+
+	Reassembly* slot = nullptr;
+	Reassembly* oldest = nullptr;
+	for (uint8_t ii = 0; ii < reassemblySlots; ++ii)
+	{
+		Reassembly& entry = this->reassembly[(start + ii) % reassemblySlots];
+		if (entry.receivedFragments == 0)
+		{
+			if (slot == nullptr) {
+				slot = &entry;
+			}
+		}
+		else if (entry.counter == counter && entry.header == header)
+		{
+			if (entry.size == size) {
+				return entry;
+			}
+			// same stream with a different size -> most likely a new message
+			slot = &entry;
+			break;
+		}
+		else if (oldest == nullptr ||
+				uint8_t(this->reassemblyAge - entry.age) >
+				uint8_t(this->reassemblyAge - oldest->age))
+		{
+			oldest = &entry;
+		}
+	}
+	if (slot == nullptr) {
+		// all slots are in use => drop the oldest incomplete packet
+		slot = oldest;
+	}
+
+	slot->header = header;
+	slot->receivedFragments = 0;
+	slot->counter = counter;
+	slot->size = size;
+	slot->age = this->reassemblyAge++;
+	return *slot;
+}
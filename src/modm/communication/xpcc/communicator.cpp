@@ -23,7 +23,7 @@ xpcc::Communicator::Communicator(
 }
 
 // ----------------------------------------------------------------------------
-void
+bool
 xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier)
 {
 	Header header(Header::Type::REQUEST, false,
@@ -32,10 +32,10 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier)
 			actionIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload);
+	return this->dispatcher.addMessage(header, payload);
 }
 
-void
+bool
 xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier, ResponseCallback& responseCallback)
 {
 	Header header(Header::Type::REQUEST, false,
@@ -44,11 +44,11 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier, Respo
 			actionIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload, responseCallback);
+	return this->dispatcher.addMessage(header, payload, responseCallback);
 }
 
 // ----------------------------------------------------------------------------
-void
+bool
 xpcc::Communicator::publishEvent(uint8_t eventIdentifier)
 {
 	Header header(Header::Type::REQUEST, false,
@@ -57,11 +57,11 @@ xpcc::Communicator::publishEvent(uint8_t eventIdentifier)
 			eventIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload);
+	return this->dispatcher.addMessage(header, payload);
 }
 
 // ----------------------------------------------------------------------------
-void
+bool
 xpcc::Communicator::sendResponse(const ResponseHandle& handle)
 {
 	Header header(Header::Type::RESPONSE, false,
@@ -70,10 +70,10 @@ xpcc::Communicator::sendResponse(const ResponseHandle& handle)
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addResponse(header, payload);
+	return this->dispatcher.addResponse(header, payload);
 }
 
-void
+bool
 xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle)
 {
 	Header header(Header::Type::NEGATIVE_RESPONSE, false,
@@ -82,5 +82,5 @@ xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle)
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload;
-	this->dispatcher.addResponse(header, payload);
+	return this->dispatcher.addResponse(header, payload);
 }
@@ -34,6 +34,10 @@ namespace xpcc
 	 * This class is just a forwarder to the Dispatcher like AbstractComponent
 	 * it also does.
 	 *
+	 * The functions return \c false if the message was dropped, because all
+	 * entries of the dispatcher are in use (see the `dispatcher.entries`
+	 * option).
+	 *
 	 * \ingroup	modm_communication_xpcc
 	 */
 	class Communicator : public Communicatable
@@ -63,41 +67,41 @@ namespace xpcc
 			return this->ownIdentifier;
 		}
 
-		void
+		bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier);
 
-		void
+		bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier, ResponseCallback& responseCallback);
 
 		template<typename T>
-		void
+		bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier, const T& data);
 
 		template<typename T>
-		void
+		bool
 		callAction(uint8_t receiver, uint8_t actionIdentifier, const T& data, ResponseCallback& responseCallback);
 
 
-		void
+		bool
 		publishEvent(uint8_t eventIdentifier);
 
 		template<typename T>
-		void
+		bool
 		publishEvent(uint8_t eventIdentifier, const T& data);
 
 
-		void
+		bool
 		sendResponse(const ResponseHandle& handle);
 
 		template<typename T>
-		void
+		bool
 		sendResponse(const ResponseHandle& handle, const T& data);
 
 		template<typename T>
-		void
+		bool
 		sendNegativeResponse(const ResponseHandle& handle, const T& data);
 
-		void
+		bool
 		sendNegativeResponse(const ResponseHandle& handle);
 
 	private:
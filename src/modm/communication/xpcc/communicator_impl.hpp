@@ -20,7 +20,7 @@
 
 // ----------------------------------------------------------------------------
 template<typename T>
-void
+bool
 xpcc::Communicator::callAction(uint8_t receiver,
 		uint8_t actionIdentifier, const T& data)
 {
@@ -31,12 +31,12 @@ xpcc::Communicator::callAction(uint8_t receiver,
 
 	modm::SmartPointer payload(&data);
 
-	this->dispatcher.addMessage(header, payload);
+	return this->dispatcher.addMessage(header, payload);
 }
 
 // ----------------------------------------------------------------------------
 template<typename T>
-void
+bool
 xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier,
 		const T& data, ResponseCallback& responseCallback)
 {
@@ -47,12 +47,12 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier,
 
 	modm::SmartPointer payload(&data);
 
-	this->dispatcher.addMessage(header, payload, responseCallback);
+	return this->dispatcher.addMessage(header, payload, responseCallback);
 }
 
 // ----------------------------------------------------------------------------
 template<typename T>
-void
+bool
 xpcc::Communicator::publishEvent(uint8_t eventIdentifier, const T& data)
 {
 	Header header(Header::Type::REQUEST, false,
@@ -61,12 +61,12 @@ xpcc::Communicator::publishEvent(uint8_t eventIdentifier, const T& data)
 			eventIdentifier);
 
 	modm::SmartPointer payload(&data);	// no metadata is sent with Events
-	this->dispatcher.addMessage(header, payload);
+	return this->dispatcher.addMessage(header, payload);
 }
 
 // ----------------------------------------------------------------------------
 template<typename T>
-void
+bool
 xpcc::Communicator::sendResponse(const ResponseHandle& handle, const T& data)
 {
 	Header header(Header::Type::RESPONSE, false,
@@ -75,11 +75,11 @@ xpcc::Communicator::sendResponse(const ResponseHandle& handle, const T& data)
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload(&data);
-	this->dispatcher.addResponse(header, payload);
+	return this->dispatcher.addResponse(header, payload);
 }
 
 template<typename T>
-void
+bool
 xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle, const T& data)
 {
 	Header header(Header::Type::NEGATIVE_RESPONSE, false,
@@ -88,5 +88,5 @@ xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle, const T&
 			handle.packetIdentifier);
 
 	modm::SmartPointer payload(&data);
-	this->dispatcher.addResponse(header, payload);
+	return this->dispatcher.addResponse(header, payload);
 }
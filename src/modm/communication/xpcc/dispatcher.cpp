@@ -26,6 +26,56 @@ xpcc::Dispatcher::Dispatcher(BackendInterface *backend_, Postman* postman_) :
 {
 }
 
+// ----------------------------------------------------------------------------
+xpcc::Dispatcher::EntryList::EntryList() :
+	free(slots)
+{
+	for (std::size_t ii = 0; ii < maxEntries - 1; ++ii) {
+		this->slots[ii].free = &this->slots[ii + 1];
+	}
+}
+
+xpcc::Dispatcher::EntryList::~EntryList()
+{
+	while (this->head) {
+		this->remove(this->head);
+	}
+}
+
+void
+xpcc::Dispatcher::EntryList::link(Entry *previous, Entry *entry)
+{
+	Entry *next = previous ? previous->next : this->head;
+	entry->previous = previous;
+	entry->next = next;
+
+	if (previous) { previous->next = entry; }
+	else { this->head = entry; }
+
+	if (next) { next->previous = entry; }
+	else { this->tail = entry; }
+}
+
+xpcc::Dispatcher::Entry *
+xpcc::Dispatcher::EntryList::remove(Entry *entry)
+{
+	Entry *next = entry->next;
+
+	if (entry->previous) { entry->previous->next = next; }
+	else { this->head = next; }
+
+	if (next) { next->previous = entry->previous; }
+	else { this->tail = entry->previous; }
+
+	// The entry is the first member of the slot
+	Slot *slot = reinterpret_cast<Slot *>(entry);
+	entry->~Entry();
+	slot->free = this->free;
+	this->free = slot;
+
+	return next;
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::Dispatcher::update()
@@ -110,8 +160,8 @@ xpcc::Dispatcher::handlePacket(const Header& header,
 		const modm::SmartPointer& payload)
 {
 	bool ack = false;
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	Entry *entry = this->entries.begin();
+	while (entry)
 	{
 		if (entry->type == Entry::Type::Default)
 		{
@@ -136,6 +186,7 @@ xpcc::Dispatcher::handlePacket(const Header& header,
 					{
 						// make sure no requests passed here
 						entry->state = Entry::State::WaitForResponse;
+						entry->time.restart(responseTimeout);
 					}
 				}
 				else
@@ -153,13 +204,13 @@ xpcc::Dispatcher::handlePacket(const Header& header,
 				return ack;
 			}
 		}
-		++entry;
+		entry = entry->next;
 	}
 	return ack;
 }
 
-xpcc::Dispatcher::EntryIterator
-xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
+xpcc::Dispatcher::Entry *
+xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry)
 {
 	// to one component on board inner component
 	// send message also out, so it is possible to log
@@ -173,10 +224,9 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 
 		if (entry->type == Entry::Type::Callback)
 		{
-			// TODO timer for RESPONSES not handeled yet
 			entry->state = Entry::State::WaitForResponse;
 			entry->time.restart(responseTimeout);
-			return entry;
+			return entry->next;
 		}
 		else {
 			return this->entries.remove(entry);
@@ -192,8 +242,7 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 		// responses are inserted at front, requests at end,
 		// thus we only need to search after the RESPONSE
 
-		auto req = entry;
-		for (++req; req != this->entries.end(); ++req)
+		for (Entry *req = entry->next; req; req = req->next)
 		{
 			if (req->header.type == Header::Type::REQUEST and
 			    // must be State::WaitForResponse
@@ -218,8 +267,8 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 void
 xpcc::Dispatcher::handleWaitingMessages()
 {
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	Entry *entry = this->entries.begin();
+	while (entry)
 	{
 		if (entry->state == Entry::State::TransmissionPending)
 		{
@@ -249,7 +298,7 @@ xpcc::Dispatcher::handleWaitingMessages()
 					entry->state = Entry::State::WaitForACK;
 					entry->time.restart(acknowledgeTimeout);
 
-					++entry;
+					entry = entry->next;
 				}
 			}
 		}
@@ -274,34 +323,43 @@ xpcc::Dispatcher::handleWaitingMessages()
 				}
 			}
 
-			++entry;
+			entry = entry->next;
 		}
 		else
 		{
 			// WAIT_FOR_RESPONSE
-			// Responses stay in the queue for ever if no response ever
-			// comes. This may have to be changed.
-			++entry;
+			// Release the entry if no response comes in time, otherwise
+			// lost responses would exhaust the pool of entries
+			if (entry->time.isExpired())
+			{
+				Header header = entry->header;
+				header.type = Header::Type::TIMEOUT;
+				entry->callbackResponse(header, entry->payload);
+				entry = this->entries.remove(entry);
+				continue;
+			}
+
+			entry = entry->next;
 		}
 	}
 }
 
 // ----------------------------------------------------------------------------
-void
+bool
 xpcc::Dispatcher::addMessage(const Header& header,
 		modm::SmartPointer& smartPayload)
 {
-	this->entries.append(Entry(header, smartPayload));
+	return this->entries.append(header, smartPayload) != nullptr;
 }
 
-void
+bool
 xpcc::Dispatcher::addMessage(const Header& header,
 		modm::SmartPointer& smartPayload, ResponseCallback& responseCallback)
 {
-	this->entries.append(Entry(header, smartPayload, responseCallback));
+	return this->entries.append(header, smartPayload, responseCallback) != nullptr;
 }
 
-void
+bool
 xpcc::Dispatcher::addResponse(const Header& header,
 		modm::SmartPointer& smartPayload)
 {
@@ -314,5 +372,5 @@ xpcc::Dispatcher::addResponse(const Header& header,
 	// but now responses are handled in reverse order that's not good
 	// what to do? a separator between responses and requests possible?
 
-	this->entries.prepend(Entry(header, smartPayload));
+	return this->entries.prepend(header, smartPayload) != nullptr;
 }
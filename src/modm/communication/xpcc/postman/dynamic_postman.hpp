@@ -22,8 +22,14 @@
 #include "../backend/header.hpp"
 #include "../response_handle.hpp"
 
-#include <map>
-#include <functional>
+#include <modm/utils/inplace_function.hpp>
+#include <vector>
+
+#ifndef MODM_XPCC_HANDLER_STORAGE
+/// Closure size of the DynamicPostman callbacks: an object and a member function pointer.
+/// @ingroup modm_communication_xpcc
+#define MODM_XPCC_HANDLER_STORAGE (3 * sizeof(void*))
+#endif
 
 namespace xpcc
 {
@@ -36,6 +42,11 @@ namespace xpcc
  *
  * On hosted however, this class allows for much easier registering of callbacks.
  *
+ * The callbacks are stored in flat tables sorted by their identifiers, which
+ * are searched by bisection, so that delivering a packet does not allocate
+ * memory. Only registering a callback may grow the tables.
+ *
+ * @warning	Callbacks must not be registered while a packet is delivered.
  * @ingroup	modm_communication_xpcc
  * @author	Niklas Hauser
  */
@@ -72,51 +83,41 @@ public:
 						  void (C::*memberFunction)(const ResponseHandle&, const P&));
 
 private:
-	typedef std::function<void (const Header&, const uint8_t&)> EventCallback;
-	typedef std::function<void (const Header&)> EventCallbackSimple;
-
-	typedef std::function<void (const ResponseHandle&, const uint8_t&)> ActionCallback;
-	typedef std::function<void (const ResponseHandle&)> ActionCallbackSimple;
+	using EventCallback = modm::inplace_function<void (const Header&, const uint8_t*),
+			MODM_XPCC_HANDLER_STORAGE, alignof(void*)>;
+	using ActionCallback = modm::inplace_function<void (const ResponseHandle&, const uint8_t*),
+			MODM_XPCC_HANDLER_STORAGE, alignof(void*)>;
 
-	class EventListener
+	struct EventListener
 	{
+		uint8_t event;
 		EventCallback call;
-		EventCallbackSimple callSimple;
-		int8_t hasPayload;
-
-	public:
-		EventListener();
-		EventListener(EventCallback call);
-		EventListener(EventCallbackSimple call);
-
-		void operator()(const Header& header, const modm::SmartPointer& payload) const;
 	};
 
-	class ActionHandler
+	struct ActionHandler
 	{
+		/// destination << 8 | packetIdentifier
+		uint16_t key;
 		ActionCallback call;
-		ActionCallbackSimple callSimple;
-		int8_t hasPayload;
-
-	public:
-		ActionHandler();
-		ActionHandler(ActionCallback call);
-		ActionHandler(ActionCallbackSimple call);
-
-		void operator()(const ResponseHandle& response, const modm::SmartPointer& payload) const;
 	};
 
-	/// packetIdentifier -> callback
-	typedef std::multimap<uint8_t, EventListener> EventMap;
+	static constexpr uint16_t
+	actionKey(uint8_t component, uint8_t action)
+	{
+		return (uint16_t(component) << 8) | action;
+	}
 
-	/// packetIdentifier -> callback
-	typedef std::map<uint8_t, ActionHandler > CallbackMap;
-	///< destination -> callbackMap
-	typedef std::map<uint8_t, CallbackMap > ActionMap;
+	bool
+	addEventListener(uint8_t eventId, EventCallback&& call);
+
+	bool
+	addActionHandler(uint8_t componentId, uint8_t actionId, ActionCallback&& call);
 
 private:
-	EventMap eventMap;
-	ActionMap actionMap;
+	/// sorted by event, listeners of the same event in order of registration
+	std::vector<EventListener> eventTable;
+	/// sorted by key, one handler per action
+	std::vector<ActionHandler> actionTable;
 };
 
 }	// namespace xpcc
@@ -16,6 +16,8 @@
 
 #include "../dynamic_postman.hpp"
 
+#include <algorithm>
+
 // ----------------------------------------------------------------------------
 xpcc::DynamicPostman::DynamicPostman()
 {
@@ -28,34 +30,32 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const modm::SmartPoint
 	if (header.destination == 0)
 	{
 		// EVENT
-		EventMap::const_iterator lowerBound(this->eventMap.lower_bound(header.packetIdentifier));
-		EventMap::const_iterator upperBound(this->eventMap.upper_bound(header.packetIdentifier));
-		if (lowerBound != upperBound) {
-			do {
-				lowerBound->second(header, payload);
-				lowerBound++;
-			}
-			while (lowerBound != upperBound);
-			return OK;
+		auto listener = std::lower_bound(eventTable.cbegin(), eventTable.cend(), header.packetIdentifier,
+				[](const EventListener& entry, uint8_t event) { return entry.event < event; });
+		if (listener == eventTable.cend() or listener->event != header.packetIdentifier) {
+			return NO_EVENT;
 		}
-		return NO_EVENT;
+		do {
+			listener->call(header, payload.getPointer());
+			listener++;
+		}
+		while (listener != eventTable.cend() and listener->event == header.packetIdentifier);
+		return OK;
 	}
 	else
 	{
 		// REQUEST
-		ActionMap::const_iterator iterDestination(this->actionMap.find(header.destination));
-		if (iterDestination != this->actionMap.end())
+		const uint16_t key = actionKey(header.destination, header.packetIdentifier);
+		auto handler = std::lower_bound(actionTable.cbegin(), actionTable.cend(), key,
+				[](const ActionHandler& entry, uint16_t key) { return entry.key < key; });
+		if (handler != actionTable.cend() and handler->key == key)
 		{
-			CallbackMap::const_iterator iterCallback(iterDestination->second.find(header.packetIdentifier));
-			if (iterCallback != iterDestination->second.end())
-			{
-				xpcc::ResponseHandle response(header);
-				iterCallback->second(response, payload);
-				return OK;
-			}
-			else {
-				return NO_ACTION;
-			}
+			xpcc::ResponseHandle response(header);
+			handler->call(response, payload.getPointer());
+			return OK;
+		}
+		else if (isComponentAvailable(header.destination)) {
+			return NO_ACTION;
 		}
 		else {
 			return NO_COMPONENT;
@@ -67,61 +67,34 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const modm::SmartPoint
 bool
 xpcc::DynamicPostman::isComponentAvailable(uint8_t component) const
 {
-	return (this->actionMap.find(component) != this->actionMap.end());
+	const uint16_t key = actionKey(component, 0);
+	auto handler = std::lower_bound(actionTable.cbegin(), actionTable.cend(), key,
+			[](const ActionHandler& entry, uint16_t key) { return entry.key < key; });
+	return (handler != actionTable.cend() and (handler->key >> 8) == component);
 }
 
 // ----------------------------------------------------------------------------
-xpcc::DynamicPostman::EventListener::EventListener() :
-		hasPayload(-1)
-{
-}
-
-xpcc::DynamicPostman::EventListener::EventListener(EventCallback call) :
-		call(call), hasPayload(1)
-{
-}
-
-xpcc::DynamicPostman::EventListener::EventListener(EventCallbackSimple call) :
-		callSimple(call), hasPayload(0)
-{
-}
-
-void
-xpcc::DynamicPostman::EventListener::operator()(
-		const Header& header,
-		const modm::SmartPointer& payload) const
-{
-	if (hasPayload > 0) {
-		call(header, *(payload.getPointer()));
-	} else if (hasPayload == 0) {
-		callSimple(header);
-	}
-}
-
-// ----------------------------------------------------------------------------
-xpcc::DynamicPostman::ActionHandler::ActionHandler() :
-		hasPayload(-1)
-{
-}
-
-xpcc::DynamicPostman::ActionHandler::ActionHandler(ActionCallback call) :
-		call(call), hasPayload(1)
-{
-}
-
-xpcc::DynamicPostman::ActionHandler::ActionHandler(ActionCallbackSimple call) :
-		callSimple(call), hasPayload(0)
+bool
+xpcc::DynamicPostman::addEventListener(uint8_t eventId, EventCallback&& call)
 {
+	// insert behind all listeners of the same event to keep the order of registration
+	auto position = std::upper_bound(eventTable.begin(), eventTable.end(), eventId,
+			[](uint8_t event, const EventListener& entry) { return event < entry.event; });
+	eventTable.insert(position, EventListener{eventId, std::move(call)});
+	return true;
 }
 
-void
-xpcc::DynamicPostman::ActionHandler::operator()(
-		const ResponseHandle& response,
-		const modm::SmartPointer& payload) const
+bool
+xpcc::DynamicPostman::addActionHandler(uint8_t componentId, uint8_t actionId, ActionCallback&& call)
 {
-	if (hasPayload > 0) {
-		call(response, *(payload.getPointer()));
-	} else if (hasPayload == 0) {
-		callSimple(response);
+	const uint16_t key = actionKey(componentId, actionId);
+	auto position = std::lower_bound(actionTable.begin(), actionTable.end(), key,
+			[](const ActionHandler& entry, uint16_t key) { return entry.key < key; });
+	if (position != actionTable.end() and position->key == key) {
+		// replace the previous handler
+		position->call = std::move(call);
+	} else {
+		actionTable.insert(position, ActionHandler{key, std::move(call)});
 	}
+	return true;
 }
@@ -21,21 +21,11 @@ xpcc::DynamicPostman::registerEventListener(const uint8_t eventId,
 		C *componentObject,
 		void (C::*memberFunction)(const Header&))
 {
-	using namespace std::placeholders;
-
-	eventMap.insert(
-			std::pair<uint8_t, EventListener>(
-					eventId,
-					EventListener(static_cast<EventCallbackSimple>(
-							std::bind(
-									memberFunction,
-									componentObject,
-									_1)
-					))
-			)
-	);
-
-	return true;
+	return addEventListener(eventId,
+			[componentObject, memberFunction](const Header& header, const uint8_t*)
+	{
+		(componentObject->*memberFunction)(header);
+	});
 }
 
 template< class C, typename P >
@@ -44,22 +34,11 @@ xpcc::DynamicPostman::registerEventListener(const uint8_t eventId,
 		C *componentObject,
 		void (C::*memberFunction)(const Header&, const P&))
 {
-	using namespace std::placeholders;
-	typedef void (C::*Function)(const Header&, const uint8_t&);
-
-	eventMap.insert(
-			std::pair<uint8_t, EventListener>(
-					eventId,
-					EventListener(
-							std::bind(
-									reinterpret_cast<Function>(memberFunction),
-									componentObject,
-									_1, _2)
-					)
-			)
-	);
-
-	return true;
+	return addEventListener(eventId,
+			[componentObject, memberFunction](const Header& header, const uint8_t* payload)
+	{
+		(componentObject->*memberFunction)(header, *reinterpret_cast<const P*>(payload));
+	});
 }
 
 template< class C >
@@ -69,16 +48,11 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 		C *componentObject,
 		void (C::*memberFunction)(const ResponseHandle&))
 {
-	using namespace std::placeholders;
-
-	actionMap[componentId][actionId] = ActionHandler(static_cast<ActionCallbackSimple>(
-			std::bind(
-					memberFunction,
-					componentObject,
-					_1)
-	));
-
-	return true;
+	return addActionHandler(componentId, actionId,
+			[componentObject, memberFunction](const ResponseHandle& response, const uint8_t*)
+	{
+		(componentObject->*memberFunction)(response);
+	});
 }
 
 template< class C, typename P >
@@ -88,15 +62,9 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 		C *componentObject,
 		void (C::*memberFunction)(const ResponseHandle&, const P&))
 {
-	using namespace std::placeholders;
-	typedef void (C::*Function)(const ResponseHandle&, const uint8_t&);
-
-	actionMap[componentId][actionId] = ActionHandler(
-			std::bind(
-					reinterpret_cast<Function>(memberFunction),
-					componentObject,
-					_1, _2)
-	);
-
-	return true;
+	return addActionHandler(componentId, actionId,
+			[componentObject, memberFunction](const ResponseHandle& response, const uint8_t* payload)
+	{
+		(componentObject->*memberFunction)(response, *reinterpret_cast<const P*>(payload));
+	});
 }
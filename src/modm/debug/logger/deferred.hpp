@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_LOG_DEFERRED_HPP
+#define MODM_LOG_DEFERRED_HPP
+
+#include <modm/io/iostream.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+
+namespace modm
+{
+	namespace log
+	{
+		/**
+		 * \brief	Deferred logger
+		 *
+		 * Records the pointer to a printf format string together with the
+		 * raw arguments into a lock-free ring buffer instead of formatting
+		 * them immediately. The messages are formatted later by calling
+		 * `process()` from a fiber, a thread or the main loop, so that
+		 * logging from an interrupt only costs a few copies.
+		 *
+		 * `log()` can be called concurrently from any interrupt, fiber or
+		 * thread, while `process()` must only be called from one context.
+		 * If the buffer is full, the message is dropped and counted.
+		 *
+		 * \code
+		 * modm::log::DeferredLogger<1024> deferred;
+		 *
+		 * // inside the interrupt
+		 * deferred.log("adc=%u error=%f\n", adc, double(error));
+		 *
+		 * // inside a fiber
+		 * while (true) {
+		 *     deferred.process(modm::log::info);
+		 *     modm::this_fiber::yield();
+		 * }
+		 * \endcode
+		 *
+		 * \warning	Only the pointers to the format string and to any string
+		 *			arguments are stored, so they must be string literals or
+		 *			otherwise outlive the call to `process()`.
+		 *
+		 * \tparam	Size	capacity of the ring buffer in bytes, must be a
+		 *					power of two
+		 *
+		 * \ingroup modm_debug
+		 */
+		template< size_t Size >
+		class DeferredLogger
+		{
+			static_assert(Size >= 64 and (Size & (Size - 1)) == 0,
+						  "DeferredLogger size must be a power of two of at least 64 bytes!");
+
+			using Decoder = void(*)(IOStream&, const char*, const uint8_t*);
+			static constexpr uint32_t Committed{0x8000'0000};
+			static constexpr uint32_t Header{sizeof(uint32_t)};
+			static constexpr uint32_t Prefix{sizeof(Decoder) + sizeof(const char*)};
+
+		public:
+			/// Maximum size of a record including format string and arguments
+			static constexpr uint32_t MaxRecordSize{64};
+
+			constexpr DeferredLogger() = default;
+
+			/**
+			 * Records a message for formatting with `IOStream::printf()`.
+			 * \note	This function can be called from an interrupt.
+			 * \return	\c false if the message was dropped
+			 */
+			template< class... Args >
+			bool
+			log(const char* format, Args... args)
+			{
+				static_assert((std::is_trivially_copyable_v<Args> and ...),
+							  "Deferred log arguments must be trivially copyable!");
+				constexpr uint32_t payload = Prefix + (sizeof(Args) + ... + 0);
+				constexpr uint32_t size = (Header + payload + 3) & ~uint32_t(3);
+				static_assert(size <= MaxRecordSize, "Too many arguments for a deferred log message!");
+
+				uint32_t position = reserved.load(std::memory_order_relaxed);
+				do if (position + size - consumed.load(std::memory_order_acquire) > Size)
+				{
+					dropped.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				while (not reserved.compare_exchange_weak(position, position + size,
+						std::memory_order_relaxed, std::memory_order_relaxed));
+
+				uint8_t record[payload];
+				const Decoder decoder = &decode<Args...>;
+				std::memcpy(record, &decoder, sizeof(decoder));
+				std::memcpy(record + sizeof(decoder), &format, sizeof(format));
+				[[maybe_unused]] uint8_t* arg = record + Prefix;
+				((std::memcpy(arg, &args, sizeof(args)), arg += sizeof(args)), ...);
+				copyIn(position + Header, record, payload);
+
+				// publishing the header hands the record to the consumer
+				std::atomic_ref(words[index(position)]).store(size | Committed, std::memory_order_release);
+				return true;
+			}
+
+			/**
+			 * Formats recorded messages into the stream in the order of
+			 * their reservation. Stops at a message that is still being
+			 * recorded.
+			 *
+			 * \return	number of formatted messages
+			 */
+			size_t
+			process(IOStream& stream, size_t max = size_t(-1))
+			{
+				size_t count{0};
+				uint32_t position = consumed.load(std::memory_order_relaxed);
+				for (; count < max; count++)
+				{
+					const uint32_t header = std::atomic_ref(words[index(position)]).load(std::memory_order_acquire);
+					if (not (header & Committed)) break;
+					const uint32_t size = header & ~Committed;
+
+					uint8_t record[MaxRecordSize];
+					copyOut(position + Header, record, size - Header);
+					// headers must never be read from stale payloads
+					for (uint32_t offset = 0; offset < size; offset += sizeof(uint32_t))
+						std::atomic_ref(words[index(position + offset)]).store(0, std::memory_order_relaxed);
+					position += size;
+					consumed.store(position, std::memory_order_release);
+
+					Decoder decoder;
+					const char* format;
+					std::memcpy(&decoder, record, sizeof(decoder));
+					std::memcpy(&format, record + sizeof(decoder), sizeof(format));
+					decoder(stream, format, record + Prefix);
+				}
+				return count;
+			}
+
+			/// \return	\c true if no messages are pending
+			bool
+			isEmpty() const
+			{
+				return reserved.load(std::memory_order_relaxed) == consumed.load(std::memory_order_relaxed);
+			}
+
+			/// \return	number of messages dropped because the buffer was full
+			uint32_t
+			getDropped() const
+			{
+				return dropped.load(std::memory_order_relaxed);
+			}
+
+		private:
+			static constexpr uint32_t
+			index(uint32_t position)
+			{
+				return (position % Size) / sizeof(uint32_t);
+			}
+
+			void
+			copyIn(uint32_t position, const uint8_t* data, uint32_t length)
+			{
+				uint8_t* const bytes = reinterpret_cast<uint8_t*>(words);
+				const uint32_t offset = position % Size;
+				const uint32_t first = std::min(length, uint32_t(Size - offset));
+				std::memcpy(bytes + offset, data, first);
+				std::memcpy(bytes, data + first, length - first);
+			}
+
+			void
+			copyOut(uint32_t position, uint8_t* data, uint32_t length) const
+			{
+				const uint8_t* const bytes = reinterpret_cast<const uint8_t*>(words);
+				const uint32_t offset = position % Size;
+				const uint32_t first = std::min(length, uint32_t(Size - offset));
+				std::memcpy(data, bytes + offset, first);
+				std::memcpy(data + first, bytes, length - first);
+			}
+
+			template< class... Args >
+			static void
+			decode(IOStream& stream, const char* format, const uint8_t* data)
+			{
+				std::tuple<Args...> args;
+				std::apply([&data](auto&... arg)
+				{
+					((std::memcpy(&arg, data, sizeof(arg)), data += sizeof(arg)), ...);
+				}, args);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-security"
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+				std::apply([&](auto... arg) { stream.printf(format, arg...); }, args);
+#pragma GCC diagnostic pop
+			}
+
+			uint32_t words[Size / sizeof(uint32_t)]{};
+			std::atomic<uint32_t> reserved{0};
+			std::atomic<uint32_t> consumed{0};
+			std::atomic<uint32_t> dropped{0};
+		};
+	}
+}
+
+#endif // MODM_LOG_DEFERRED_HPP
@@ -39,22 +39,36 @@ protected:
 
 		this->transaction_success = true;
 
-		this->commandBuffer[0] = ssd1306::AdressingCommands::HigherColumnStartAddress;
-		this->commandBuffer[1] = 0x02;
-
-		for (page = 0; page < Height / 8; page++)
+		for (this->page = 0; this->page < Height / 8; this->page++)
 		{
-			this->commandBuffer[2] = 0xB0 | page;
+			if (this->dirty[this->page].isEmpty()) continue;
+
+			this->columnFirst = this->dirty[this->page].first;
+			this->columnLast = this->dirty[this->page].last;
+			this->clearDirty(this->page);
+
+			// The RAM is 132 columns wide with the display starting at column 2
+			this->commandBuffer[0] = 0xB0 | this->page;
+			this->commandBuffer[1] = ssd1306::AdressingCommands::LowerColumnStartAddress |
+									 ((this->columnFirst + 2) & 0x0f);
+			this->commandBuffer[2] = ssd1306::AdressingCommands::HigherColumnStartAddress |
+									 ((this->columnFirst + 2) >> 4);
 			this->transaction_success &= RF_CALL(this->writeCommands(3));
 
 			RF_WAIT_UNTIL(
-				this->transaction.configureDisplayWrite((uint8_t*)&this->buffer[page], 128));
+				this->transaction.configureDisplayWrite(&this->buffer[this->page][this->columnFirst],
+														this->columnLast - this->columnFirst + 1));
 			RF_WAIT_UNTIL(this->startTransaction());
 			RF_WAIT_WHILE(this->isTransactionRunning());
-			this->transaction_success &= this->wasTransactionSuccessful();
-		};
 
-		RF_END_RETURN(this->transaction_success);
+			if (not this->wasTransactionSuccessful())
+			{
+				this->transaction_success = false;
+				this->markDirty(this->page, this->page, this->columnFirst, this->columnLast);
+			}
+		}
+
+		RF_END();
 	}
 
 	modm::ResumableResult<void>
@@ -67,9 +81,6 @@ protected:
 		this->transaction_success &= RF_CALL(this->writeCommands(2));
 		RF_END();
 	}
-
-private:
-	size_t page;
 };
 
 }  // namespace modm
@@ -113,6 +113,7 @@ public:
 	{ return RF_CALL_BLOCKING(initialize()); }
 
 	/// Update the display with the content of the RAM buffer.
+	/// Only the modified columns of each page are transmitted.
 	void
 	update() override
 	{ RF_CALL_BLOCKING(startWriteDisplay()); }
@@ -180,8 +181,16 @@ protected:
 	virtual modm::ResumableResult<void>
 	startWriteDisplay();
 
+	/// Sets the column and page range written by the display data
+	modm::ResumableResult<bool>
+	writeWindow(uint8_t pageFirst, uint8_t columnFirst, uint8_t pageLast, uint8_t columnLast);
+
 	uint8_t commandBuffer[7];
 	bool transaction_success;
+
+	uint8_t page;
+	uint8_t columnFirst;
+	uint8_t columnLast;
 };
 
 }  // namespace modm
@@ -102,13 +102,68 @@ modm::Ssd1306<I2cMaster, Height>::startWriteDisplay()
 {
 	RF_BEGIN();
 
-	RF_WAIT_UNTIL(
-		this->transaction.configureDisplayWrite((uint8_t*)(&this->buffer), sizeof(this->buffer)) and
-		this->startTransaction());
+	transaction_success = true;
+
+	if (this->isCompletelyDirty())
+	{
+		// send the whole buffer in one transaction without waiting for it
+		this->clearDirty();
+		if (not RF_CALL(writeWindow(0, 0, Height / 8 - 1, 127)))
+		{
+			transaction_success = false;
+			this->markDirty();
+			RF_RETURN();
+		}
+		RF_WAIT_UNTIL(
+			this->transaction.configureDisplayWrite((uint8_t*)(&this->buffer), sizeof(this->buffer)) and
+			this->startTransaction());
+		RF_RETURN();
+	}
+
+	// send only the modified columns of each page
+	for (page = 0; page < Height / 8; page++)
+	{
+		if (this->dirty[page].isEmpty()) continue;
+
+		columnFirst = this->dirty[page].first;
+		columnLast = this->dirty[page].last;
+		this->clearDirty(page);
+
+		if (not RF_CALL(writeWindow(page, columnFirst, page, columnLast)))
+		{
+			transaction_success = false;
+			this->markDirty(page, page, columnFirst, columnLast);
+			continue;
+		}
+		RF_WAIT_UNTIL(
+			this->transaction.configureDisplayWrite(&this->buffer[page][columnFirst],
+													columnLast - columnFirst + 1) and
+			this->startTransaction());
+		RF_WAIT_WHILE(this->isTransactionRunning());
+
+		if (not this->wasTransactionSuccessful()) {
+			transaction_success = false;
+			this->markDirty(page, page, columnFirst, columnLast);
+		}
+	}
 
 	RF_END();
 }
 
+template<class I2cMaster, uint8_t Height>
+modm::ResumableResult<bool>
+modm::Ssd1306<I2cMaster, Height>::writeWindow(uint8_t pageFirst, uint8_t columnFirst,
+											  uint8_t pageLast, uint8_t columnLast)
+{
+	commandBuffer[0] = AdressingCommands::ColumnAddress;
+	commandBuffer[1] = columnFirst;
+	commandBuffer[2] = columnLast;
+	commandBuffer[3] = AdressingCommands::PageAddress;
+	commandBuffer[4] = pageFirst;
+	commandBuffer[5] = pageLast;
+	return writeCommands(6);
+}
+
 template<class I2cMaster, uint8_t Height>
 modm::ResumableResult<bool>
 modm::Ssd1306<I2cMaster, Height>::writeDisplay()
@@ -119,7 +174,17 @@ modm::Ssd1306<I2cMaster, Height>::writeDisplay()
 
 	RF_WAIT_WHILE(this->isTransactionRunning());
 
-	RF_END_RETURN(this->wasTransactionSuccessful());
+	// the failed regions have already been marked dirty again
+	if (not transaction_success) RF_RETURN(false);
+
+	if (not this->wasTransactionSuccessful())
+	{
+		// the content of the display is unknown now
+		this->markDirty();
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN(true);
 }
 
 template<class I2cMaster, uint8_t Height>
@@ -14,6 +14,7 @@
 
 #include <modm/architecture/interface/assert.hpp>
 #include <modm/architecture/interface/gpio.hpp>
+#include <algorithm>
 
 namespace modm
 {
@@ -77,7 +78,8 @@ St7586s<SPI, CS, RST, DC, Width, Height>::setClipping(uint16_t x, uint16_t y, ui
 	namespace payload = detail::st7586s::payload;
 
 	modm_assert_continue_fail_debug(x < Width, "st4586s.sc.x", "x >= Width", x);
-	modm_assert_continue_fail_debug(x + w <= Width, "st4586s.sc.xw", "x + w >= Width", x + w);
+	modm_assert_continue_fail_debug(x + w <= (Width + pixelsPerByte - 1) / pixelsPerByte * pixelsPerByte,
+		"st4586s.sc.xw", "x + w >= Width", x + w);
 	modm_assert_continue_fail_debug(y < Height, "st4586s.sc.y", "y >= Height", y);
 	modm_assert_continue_fail_debug(y + h <= Height, "st4586s.sc.yh", "y + h >= Height", y + h);
 	modm_assert_continue_fail_debug((x % pixelsPerByte) == 0, "st4586s.sc.x%",
@@ -96,29 +98,45 @@ template <typename SPI, typename CS, typename RST, typename DC, int Width, int H
 void
 St7586s<SPI, CS, RST, DC, Width, Height>::update()
 {
+	// Find the bounding box of all modified bytes
+	int16_t rowFirst = -1, rowLast = -1;
+	uint16_t byteFirst = Width / 8, byteLast = 0;
+	for (int16_t y = 0; y < Height; y++)
+	{
+		if (this->dirty[y].isEmpty()) continue;
+		if (rowFirst < 0) rowFirst = y;
+		rowLast = y;
+		byteFirst = std::min<uint16_t>(byteFirst, this->dirty[y].first);
+		byteLast = std::max<uint16_t>(byteLast, this->dirty[y].last);
+	}
+	if (rowFirst < 0) return;
+	this->clearDirty();
+
+	// The display packs three pixels into one byte, so the window is widened
+	// to whole column groups and the pixels beyond the width are sent blank
+	const uint16_t xFirst = (byteFirst * 8) / pixelsPerByte * pixelsPerByte;
+	const uint16_t xLast = (std::min<uint16_t>(Width, (byteLast + 1) * 8) + pixelsPerByte - 1)
+			/ pixelsPerByte * pixelsPerByte;
+	setClipping(xFirst, rowFirst, xLast - xFirst, rowLast - rowFirst + 1);
+
 	sendCommand(Command::WriteDisplayData);
 	CS::reset();
-	// TODO: support windows other than full screen (then make setClipping public)
-	// TODO: transfer the whole memory area, not individual pixels
-	for (uint16_t y = 0; y < Height; y++) {
+	uint8_t cells[(Width + pixelsPerByte - 1) / pixelsPerByte];
+	for (int16_t y = rowFirst; y <= rowLast; y++)
+	{
 		const uint8_t* row = this->buffer[y];
-		uint16_t currentByte = 0;
-		uint8_t validBits = 0;
-		for (uint16_t x = 0; x + 2 < Width; x += 3) {
-			if (validBits < 3) {
-				currentByte |= (*row++) << validBits;
-				validBits += 8;
-			}
-
+		const auto pixel = [row](uint16_t x)
+		{ return x < Width and (row[x / 8] & (1 << (x % 8))); };
+		uint16_t length = 0;
+		for (uint16_t x = xFirst; x < xLast; x += pixelsPerByte)
+		{
 			uint8_t cell = 0;
-			if (currentByte & 0b001) cell |= (0b11 << 6);
-			if (currentByte & 0b010) cell |= (0b11 << 3);
-			if (currentByte & 0b100) cell |= (0b11 << 0);
-			validBits -= 3;
-			currentByte >>= 3;
-
-			SPI::transferBlocking(cell);
+			if (pixel(x + 0)) cell |= (0b11 << 6);
+			if (pixel(x + 1)) cell |= (0b11 << 3);
+			if (pixel(x + 2)) cell |= (0b11 << 0);
+			cells[length++] = cell;
 		}
+		SPI::transferBlocking(cells, nullptr, length);
 	}
 	CS::set();
 }
@@ -16,6 +16,7 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <limits>
 #include <type_traits>
 #include <modm/architecture/utils.hpp>
 
@@ -26,6 +27,13 @@ namespace modm
 /**
  * Memory allocator.
  *
+ * Free runs of blocks are kept in segregated free lists, one per power-of-two
+ * size class, with a bitmap of the non-empty classes. Allocation therefore
+ * only looks at the head of the smallest class that is guaranteed to fit, and
+ * only walks the list of its own size class if no larger class is available.
+ * The list links are stored inside the free runs themselves, so there is no
+ * additional memory overhead.
+ *
  * @tparam	BLOCK_SIZE
  * 		Size of one allocatable block in words (sizeof(T) bytes)
  *		(BLOCKSIZE * sizeof(T) * n) - 4 has to be dividable by 4 for every n
@@ -37,6 +45,12 @@ template <typename T, unsigned int BLOCK_SIZE >
 class BlockAllocator
 {
 	using SignedType = std::make_signed_t<T>;
+	static_assert(BLOCK_SIZE >= 4, "A free block must fit its size markers and free list links!");
+	static_assert(sizeof(T) <= sizeof(uint32_t), "The free list bitmap only supports up to 32 size classes!");
+
+	static constexpr uint8_t Classes = sizeof(T) * 8;
+	static constexpr T Null = std::numeric_limits<T>::max();
+
 public:
 	/**
 	 * Initialize the raw memory.
@@ -53,10 +67,25 @@ public:
 	void
 	initialize(void * heapStart, void * heapEnd);
 
-	/// Allocate memory
+	/// Allocate memory, usually in O(1)
 	void *
 	allocate(std::size_t requestedSize);
 
+	/**
+	 * Resize allocated memory.
+	 *
+	 * Shrinking and growing into a directly following free run is done in
+	 * place, otherwise the memory is moved into a new allocation.
+	 *
+	 * @param	ptr
+	 * 		Must be the same pointer previously acquired by allocate()
+	 * 		or `nullptr`.
+	 * @return	pointer to the resized memory, or `nullptr` if there is not
+	 * 		enough memory left, in which case `ptr` stays valid.
+	 */
+	void *
+	reallocate(void *ptr, std::size_t requestedSize);
+
 	/**
 	 * Free memory in O(1)
 	 *
@@ -68,19 +97,85 @@ public:
 	free(void *ptr);
 
 public:
+	/// Free memory in bytes including management data in O(1)
 	std::size_t
 	getAvailableSize() const;
 
+	/// Allocated memory in bytes including management data in O(1)
+	std::size_t
+	getUsedSize() const;
+
+	/// Maximum of getUsedSize() since initialization
+	std::size_t
+	getMaxUsedSize() const;
+
+	/// Size of the largest continuous free run in bytes
+	std::size_t
+	getLargestFreeSize() const;
+
+	/**
+	 * Fragmentation of the free memory in percent.
+	 *
+	 * 0% means all free memory is available as one continuous run, while
+	 * values close to 100% mean that the free memory is split into many
+	 * small runs.
+	 */
+	uint8_t
+	getFragmentation() const;
+
 private:
 	// Align the pointer to a multiple of MODM_ALIGNMENT
 	T *
 	alignPointer(void * ptr) const;
 
-	//static const int MAX_BLOCK_PARTS = 2048;
+	std::size_t
+	getSlots(std::size_t requestedSize) const;
+
+	static uint8_t
+	getClass(std::size_t slots);
+
+	T *
+	findFree(T neededSlots) const;
+
+	void
+	markUsed(T *p, T slots);
+
+	void
+	insertFree(T *p, T slots);
+
+	void
+	removeFree(T *p);
+
+	void
+	releaseFree(T *p, T slots);
+
+	static bool
+	isFree(const T *marker)
+	{ return SignedType(*marker) < 0; }
+
+	static T
+	getFreeSlots(const T *marker)
+	{ return -SignedType(*marker); }
+
+	T *
+	getBlock(T index) const
+	{ return start + index * BLOCK_SIZE; }
+
+	T
+	getIndex(const T *p) const
+	{ return (p - start) / BLOCK_SIZE; }
 
 	T* start;
 	T* end;
-	T* freeHint;
+
+	// Index of the first free run of each size class, linked through
+	// the second (next) and third (previous) word of each free run.
+	T freeHeads[Classes];
+	uint32_t freeMap;
+
+	T totalSlots;
+	T usedSlots;
+	T maxUsedSlots;
 };
 
 } // namespace modm
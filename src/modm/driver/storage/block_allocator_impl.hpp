@@ -15,6 +15,8 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <iterator>
 
 // ----------------------------------------------------------------------------
 /*
@@ -68,64 +70,100 @@ modm::BlockAllocator<T, BLOCK_SIZE>::initialize(void * heapStart, void * heapEnd
 
 	// integer division which will automatically round down
 	std::size_t size = memory / (BLOCK_SIZE * sizeof(T));
+	// the size of a free run is stored negated
+	size = std::min<std::size_t>(size, std::numeric_limits<SignedType>::max());
 
-	end = (uint16_t *)((uintptr_t) start + (size * BLOCK_SIZE * sizeof(T)));
+	end = (T *)((uintptr_t) start + (size * BLOCK_SIZE * sizeof(T)));
 
-	*start = -size;
-	*(end - 1) = -size;
+	std::fill(std::begin(freeHeads), std::end(freeHeads), Null);
+	freeMap = 0;
+	totalSlots = size;
+	usedSlots = 0;
+	maxUsedSlots = 0;
 
-	freeHint = start;
+	if (size) {
+		insertFree(start, size);
+	}
 }
 
 // ----------------------------------------------------------------------------
-/*
- *
- *
- */
 template <typename T, unsigned int BLOCK_SIZE >
 void *
 modm::BlockAllocator<T, BLOCK_SIZE>::allocate(std::size_t requestedSize)
 {
-	requestedSize += 4;	// bytes needed for the management
+	std::size_t neededSlots = getSlots(requestedSize);
+	if (neededSlots > std::size_t(totalSlots - usedSlots)) {
+		return 0;
+	}
 
-	std::size_t neededSlots = (requestedSize + (BLOCK_SIZE * sizeof(T) - 1)) /
-			(BLOCK_SIZE * sizeof(T));
+	T *p = findFree(neededSlots);
+	if (p == 0) {
+		return 0;
+	}
+
+	T freeSlots = getFreeSlots(p);
+	removeFree(p);
+	markUsed(p, neededSlots);
 
-	T *p = freeHint;
-	do
+	if (freeSlots > neededSlots)
 	{
-		SignedType slots = *p;
+		// if the allocated space are smaller than original one,
+		// than we get a new slice of free slots. Its upper neighbour
+		// is never free, since free runs are always merged.
+		insertFree(p + neededSlots * BLOCK_SIZE, freeSlots - neededSlots);
+	}
+	return (void *) (p + 1);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, unsigned int BLOCK_SIZE >
+void *
+modm::BlockAllocator<T, BLOCK_SIZE>::reallocate(void *ptr, std::size_t requestedSize)
+{
+	if (ptr == 0) {
+		return allocate(requestedSize);
+	}
+
+	T *p = (T *) ptr;
+	p -= 1;
 
-		if (slots < 0)
+	const T slots = *p;
+	const std::size_t neededSlots = getSlots(requestedSize);
+
+	if (neededSlots <= slots)
+	{
+		// shrink in place and give the rest back
+		if (neededSlots < slots)
 		{
-			// slots < 0 => free slots
-			slots = -slots;
-
-			T freeSlots = slots;
-			if (freeSlots >= neededSlots)
-			{
-				// write the marker on the first an last slot of the field of
-				// new allocated slots
-				*p = neededSlots;
-				*(p + neededSlots * BLOCK_SIZE - 1) = neededSlots;
-
-				if (freeSlots > neededSlots)
-				{
-					// if the allocated space are smaller than original one,
-					// than we get a new slice of free slots and need set the
-					// new marker for this field
-					*(p + neededSlots * BLOCK_SIZE) = -(freeSlots - neededSlots);
-					*(p + freeSlots  * BLOCK_SIZE - 1) = -(freeSlots - neededSlots);
-				}
-				return (void *) (p + 1);
-			}
+			usedSlots -= slots;
+			markUsed(p, neededSlots);
+			releaseFree(p + neededSlots * BLOCK_SIZE, slots - neededSlots);
 		}
+		return ptr;
+	}
 
-		p += slots * BLOCK_SIZE;
+	// grow in place if the slots above are free and large enough
+	T *next = p + slots * BLOCK_SIZE;
+	if (next < end and isFree(next) and
+		slots + std::size_t(getFreeSlots(next)) >= neededSlots)
+	{
+		const T available = slots + getFreeSlots(next);
+		removeFree(next);
+		usedSlots -= slots;
+		markUsed(p, neededSlots);
+		if (available > neededSlots) {
+			insertFree(p + neededSlots * BLOCK_SIZE, available - neededSlots);
+		}
+		return ptr;
 	}
-	while (p < end);
 
-	return 0;
+	// otherwise move the payload into a new allocation
+	void *moved = allocate(requestedSize);
+	if (moved) {
+		std::copy(p + 1, p + slots * BLOCK_SIZE - 1, (T *) moved);
+		free(ptr);
+	}
+	return moved;
 }
 
 // ----------------------------------------------------------------------------
@@ -140,70 +178,188 @@ modm::BlockAllocator<T, BLOCK_SIZE>::free(void *ptr)
 	T *p = (T *) ptr;
 	p -= 1;
 
-	SignedType slots = *p;
-	T freeSlots = slots;
+	const T slots = *p;
+	usedSlots -= slots;
+	releaseFree(p, slots);
+}
 
-	// check whether the slots above are free
-	if (p + slots * BLOCK_SIZE < end) {
-		slots = *(p + slots * BLOCK_SIZE);
-		if (slots < 0) {
-			freeSlots += -slots;
-		}
-	}
+// ----------------------------------------------------------------------------
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getAvailableSize() const
+{
+	return std::size_t(totalSlots - usedSlots) * BLOCK_SIZE * sizeof(T);
+}
 
-	// check the slots below
-	if (p - 1 >= start) {
-		slots = *(p - 1);
-		if (slots < 0) {
-			p += slots * BLOCK_SIZE;
-			freeSlots += -slots;
-		}
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getUsedSize() const
+{
+	return std::size_t(usedSlots) * BLOCK_SIZE * sizeof(T);
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getMaxUsedSize() const
+{
+	return std::size_t(maxUsedSlots) * BLOCK_SIZE * sizeof(T);
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getLargestFreeSize() const
+{
+	if (freeMap == 0) {
+		return 0;
 	}
 
-	// write the markers
-//	if (freeSlots > MAX_BLOCK_PARTS)
-//	{
-//		// memory area is to big, split it in two parts
-//		*p = -MAX_BLOCK_PARTS;
-//		*(p + MAX_BLOCK_PARTS * BLOCK_SIZE - 1) = -MAX_BLOCK_PARTS;
-//
-//		*(p + MAX_BLOCK_PARTS * BLOCK_SIZE) = -(freeSlots - MAX_BLOCK_PARTS);
-//		*(p + freeSlots * BLOCK_SIZE - 1) = -(freeSlots - MAX_BLOCK_PARTS);
-//	}
-//	else
-//	{
-		*p = -freeSlots;
-		*(p + freeSlots * BLOCK_SIZE - 1) = -freeSlots;
-//	}
+	// the largest run must be in the largest non-empty size class
+	const uint8_t sizeClass = std::bit_width(freeMap) - 1;
+	T largest = 0;
+	for (T index = freeHeads[sizeClass]; index != Null; index = getBlock(index)[1]) {
+		largest = std::max(largest, getFreeSlots(getBlock(index)));
+	}
+	return std::size_t(largest) * BLOCK_SIZE * sizeof(T);
+}
 
-	if (p < freeHint) {
-		freeHint = p;
+template <typename T, unsigned int BLOCK_SIZE >
+uint8_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getFragmentation() const
+{
+	const std::size_t available = getAvailableSize();
+	if (available == 0) {
+		return 0;
 	}
+	return 100 - (getLargestFreeSize() * 100) / available;
 }
 
 // ----------------------------------------------------------------------------
 template <typename T, unsigned int BLOCK_SIZE >
 std::size_t
-modm::BlockAllocator<T, BLOCK_SIZE>::getAvailableSize() const
+modm::BlockAllocator<T, BLOCK_SIZE>::getSlots(std::size_t requestedSize) const
 {
-	T *p = start;
-	std::size_t size = 0;
+	// bytes needed for the management
+	requestedSize += 2 * sizeof(T);
 
-	do {
-		SignedType slots = *p;
+	return (requestedSize + (BLOCK_SIZE * sizeof(T) - 1)) /
+			(BLOCK_SIZE * sizeof(T));
+}
 
-		if (slots < 0)
-		{
-			// slots < 0 => free slots
-			slots = -slots;
-			size += slots * BLOCK_SIZE * sizeof(T);
+template <typename T, unsigned int BLOCK_SIZE >
+uint8_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getClass(std::size_t slots)
+{
+	// size class n contains the free runs of [2^n, 2^(n+1)) slots
+	return std::bit_width(slots) - 1;
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+T *
+modm::BlockAllocator<T, BLOCK_SIZE>::findFree(T neededSlots) const
+{
+	const uint8_t sizeClass = getClass(neededSlots);
+
+	// the first run of the own size class is the best fit, if it is large enough
+	T index = freeHeads[sizeClass];
+	if (index != Null and getFreeSlots(getBlock(index)) >= neededSlots) {
+		return getBlock(index);
+	}
+
+	// every run in a larger size class is large enough
+	const uint32_t larger = freeMap & (uint32_t(-2) << sizeClass);
+	if (larger) {
+		return getBlock(freeHeads[std::countr_zero(larger)]);
+	}
+
+	// only the remaining runs of the own size class may still fit
+	for (; index != Null; index = getBlock(index)[1])
+	{
+		T *p = getBlock(index);
+		if (getFreeSlots(p) >= neededSlots) {
+			return p;
 		}
+	}
+	return 0;
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::markUsed(T *p, T slots)
+{
+	// write the marker on the first an last slot of the field of
+	// allocated slots
+	*p = slots;
+	*(p + slots * BLOCK_SIZE - 1) = slots;
+
+	usedSlots += slots;
+	maxUsedSlots = std::max(maxUsedSlots, usedSlots);
+}
 
-		p += slots * BLOCK_SIZE;
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::insertFree(T *p, T slots)
+{
+	const uint8_t sizeClass = getClass(slots);
+	const T index = getIndex(p);
+
+	*p = -slots;
+	*(p + slots * BLOCK_SIZE - 1) = -slots;
+
+	// push to the front of the free list
+	const T head = freeHeads[sizeClass];
+	p[1] = head;
+	p[2] = Null;
+	if (head != Null) {
+		getBlock(head)[2] = index;
+	}
+	freeHeads[sizeClass] = index;
+	freeMap |= uint32_t(1) << sizeClass;
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::removeFree(T *p)
+{
+	const uint8_t sizeClass = getClass(getFreeSlots(p));
+	const T next = p[1];
+	const T previous = p[2];
+
+	if (previous != Null) {
+		getBlock(previous)[1] = next;
+	} else {
+		freeHeads[sizeClass] = next;
+	}
+	if (next != Null) {
+		getBlock(next)[2] = previous;
+	}
+
+	if (freeHeads[sizeClass] == Null) {
+		freeMap &= ~(uint32_t(1) << sizeClass);
+	}
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+void
+modm::BlockAllocator<T, BLOCK_SIZE>::releaseFree(T *p, T slots)
+{
+	// check whether the slots above are free
+	T *next = p + slots * BLOCK_SIZE;
+	if (next < end and isFree(next))
+	{
+		slots += getFreeSlots(next);
+		removeFree(next);
+	}
+
+	// check the slots below
+	if (p > start and isFree(p - 1))
+	{
+		const T previousSlots = getFreeSlots(p - 1);
+		p -= previousSlots * BLOCK_SIZE;
+		slots += previousSlots;
+		removeFree(p);
 	}
-	while (p < end);
 
-	return size;
+	insertFree(p, slots);
 }
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,198 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_CACHE_HPP
+#define MODM_BLOCK_DEVICE_CACHE_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/processing/resumable.hpp>
+#include <stddef.h>
+
+namespace modm
+{
+
+/**
+ * \brief	Write-back cache in front of another block device
+ *
+ * The cache consists of `Lines` lines of `LineSize` bytes, which are
+ * aligned to their size and replaced in least recently used order.
+ *
+ * - Reads are served from the cache and may have any size and alignment.
+ *   A miss reads the whole line from the block device. If a miss follows
+ *   directly after the previously read line, the next line is read ahead.
+ * - Programs are collected in the cache. Adjacent programs to the same line
+ *   are coalesced into one program of the block device, which happens when
+ *   the line is replaced or on `flush()`. Only the programmed bytes are
+ *   written, so the constraints of the block device still apply.
+ * - Erases are forwarded immediately and invalidate the affected lines.
+ *   Programs to the erased area, which are still in the cache, are dropped.
+ *
+ * Call `flush()` or `deinitialize()` to make sure all data has reached the
+ * block device.
+ *
+ * \tparam Device		The cached block device
+ * \tparam Lines		Number of cache lines
+ * \tparam LineSize		Size of a cache line in bytes (multiple of the read
+ * 						and write block sizes of the block device)
+ *
+ * \ingroup	modm_driver_block_device_cache
+ */
+template <typename Device, size_t Lines, size_t LineSize>
+class BdCache : public modm::BlockDevice, protected NestedResumable<4>
+{
+	static_assert(Lines > 0, "The cache needs at least one line!");
+	static_assert(LineSize % Device::BlockSizeRead == 0,
+			"LineSize must be a multiple of the read block size!");
+	static_assert(LineSize % Device::BlockSizeWrite == 0,
+			"LineSize must be a multiple of the write block size!");
+	static_assert(Device::DeviceSize % LineSize == 0,
+			"The device size must be a multiple of LineSize!");
+
+public:
+	BdCache()
+	{ invalidate(); }
+
+	/// Initializes the storage hardware and invalidates the cache
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Flushes the cache and deinitializes the storage hardware
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  Any block has to be erased prior to being programmed
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of write block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  The state of an erased block is undefined until it has been programmed
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of erase block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks after erasing them
+	*
+	*  The blocks are erased prior to being programmed
+	*
+	*  @param buffer	Buffer of data to write to blocks
+	*  @param address	Address of first block to begin writing to
+	*  @param size		Size to write in bytes (multiple of read block size)
+	*  @return			True on success
+	*/
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Programs all cached data to the block device
+	 *
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	flush();
+
+	/// Drops all cached data, including programs that were not flushed yet
+	void
+	invalidate();
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = Device::BlockSizeWrite;
+	static constexpr bd_size_t BlockSizeErase = Device::BlockSizeErase;
+	static constexpr bd_size_t DeviceSize = Device::DeviceSize;
+
+public:
+	/** Direct access to the cached block device
+	*
+	*  Accesses bypass the cache, so flush or invalidate it as required.
+	*
+	*  @return	Device
+	*/
+	inline Device& getBlockDevice() {return blockDevice;};
+
+private:
+	struct Line
+	{
+		bd_address_t address;
+		uint32_t lastUse;
+		/// programmed range [dirtyBegin, dirtyEnd) relative to the line
+		bd_size_t dirtyBegin;
+		bd_size_t dirtyEnd;
+		bool valid;
+		uint8_t data[LineSize];
+
+		bool
+		isDirty() const
+		{ return dirtyBegin != dirtyEnd; }
+	};
+
+	static constexpr bd_address_t
+	alignToLine(bd_address_t address)
+	{ return address - (address % LineSize); }
+
+	/// @return	index of the line or `Lines` if not cached
+	size_t
+	find(bd_address_t address) const;
+
+	void
+	touch(size_t index);
+
+	/// Replaces the least recently used line with `address` and stores its index in `line`
+	modm::ResumableResult<bool>
+	load(bd_address_t address, bool fill);
+
+	modm::ResumableResult<bool>
+	flushLine(size_t index);
+
+private:
+	Device blockDevice;
+	Line lines[Lines];
+
+	uint32_t useCounter;
+	bd_address_t sequentialAddress;
+
+	// state of the resumable functions
+	size_t line;
+	size_t flushIndex;
+	bd_address_t position;
+	bd_address_t end;
+	uint8_t* destination;
+	const uint8_t* source;
+	bool sequential;
+	bool result;
+};
+
+}
+#include "block_device_cache_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_CACHE_HPP
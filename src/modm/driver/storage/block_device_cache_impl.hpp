@@ -0,0 +1,324 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_CACHE_HPP
+	#error	"Don't include this file directly, use 'block_device_cache.hpp' instead!"
+#endif
+#include "block_device_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::initialize()
+{
+	RF_BEGIN();
+
+	invalidate();
+
+	RF_END_RETURN_CALL(blockDevice.initialize());
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::deinitialize()
+{
+	RF_BEGIN();
+
+	result = RF_CALL(flush());
+	result &= RF_CALL(blockDevice.deinitialize());
+
+	RF_END_RETURN(result);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	sequential = (address == sequentialAddress);
+	sequentialAddress = address + size;
+	position = address;
+	end = address + size;
+	destination = buffer;
+
+	while (position < end)
+	{
+		line = find(alignToLine(position));
+		if (line == Lines)
+		{
+			if (!RF_CALL(load(alignToLine(position), true))) {
+				RF_RETURN(false);
+			}
+		}
+		{
+			const bd_size_t offset = position - lines[line].address;
+			const bd_size_t chunk = std::min<bd_size_t>(end - position, LineSize - offset);
+			std::memcpy(destination, &lines[line].data[offset], chunk);
+			touch(line);
+			position += chunk;
+			destination += chunk;
+		}
+	}
+
+	// read ahead the next line, while data is read sequentially
+	position = alignToLine(end - 1) + LineSize;
+	if (sequential and (Lines > 1) and (position < DeviceSize) and (find(position) == Lines))
+	{
+		// the read itself succeeded, a failure only leaves the line empty
+		RF_CALL(load(position, true));
+	}
+
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	position = address;
+	end = address + size;
+	source = buffer;
+
+	while (position < end)
+	{
+		line = find(alignToLine(position));
+		if (line == Lines)
+		{
+			// lines which are programmed completely do not need to be read
+			if (!RF_CALL(load(alignToLine(position),
+					(position % LineSize != 0) || (end - position < LineSize)))) {
+				RF_RETURN(false);
+			}
+		}
+		else if (lines[line].isDirty() and
+				 ((position - lines[line].address > lines[line].dirtyEnd) or
+				  (std::min<bd_address_t>(end, lines[line].address + LineSize) - lines[line].address < lines[line].dirtyBegin)))
+		{
+			// only adjacent programs are coalesced, since programming the
+			// gap in between again is not allowed on every device
+			if (!RF_CALL(flushLine(line))) {
+				RF_RETURN(false);
+			}
+		}
+		{
+			Line& cached = lines[line];
+			const bd_size_t offset = position - cached.address;
+			const bd_size_t chunk = std::min<bd_size_t>(end - position, LineSize - offset);
+			std::memcpy(&cached.data[offset], source, chunk);
+			if (cached.isDirty()) {
+				cached.dirtyBegin = std::min(cached.dirtyBegin, offset);
+				cached.dirtyEnd = std::max(cached.dirtyEnd, offset + chunk);
+			} else {
+				cached.dirtyBegin = offset;
+				cached.dirtyEnd = offset + chunk;
+			}
+			touch(line);
+			position += chunk;
+			source += chunk;
+		}
+	}
+
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	for (flushIndex = 0; flushIndex < Lines; flushIndex++)
+	{
+		if (not lines[flushIndex].valid or
+			(lines[flushIndex].address + LineSize <= address) or
+			(lines[flushIndex].address >= address + size)) {
+			continue;
+		}
+		// programs outside of the erased area must not get lost
+		if (lines[flushIndex].isDirty() and
+			((lines[flushIndex].address + lines[flushIndex].dirtyBegin < address) or
+			 (lines[flushIndex].address + lines[flushIndex].dirtyEnd > address + size)))
+		{
+			if (!RF_CALL(flushLine(flushIndex))) {
+				RF_RETURN(false);
+			}
+		}
+		lines[flushIndex].valid = false;
+		lines[flushIndex].dirtyBegin = lines[flushIndex].dirtyEnd = 0;
+	}
+
+	RF_END_RETURN_CALL(blockDevice.erase(address, size));
+}
+
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (size % BlockSizeWrite != 0)) {
+		RF_RETURN(false);
+	}
+
+	if(!RF_CALL(this->erase(address, size))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->program(buffer, address, size));
+}
+
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::flush()
+{
+	RF_BEGIN();
+
+	result = true;
+	for (flushIndex = 0; flushIndex < Lines; flushIndex++)
+	{
+		if (lines[flushIndex].isDirty()) {
+			result &= RF_CALL(flushLine(flushIndex));
+		}
+	}
+
+	RF_END_RETURN(result);
+}
+
+template <typename Device, size_t Lines, size_t LineSize>
+void
+modm::BdCache<Device, Lines, LineSize>::invalidate()
+{
+	for (Line& cached : lines)
+	{
+		cached.valid = false;
+		cached.lastUse = 0;
+		cached.dirtyBegin = cached.dirtyEnd = 0;
+	}
+	useCounter = 0;
+	sequentialAddress = DeviceSize;
+}
+
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t Lines, size_t LineSize>
+size_t
+modm::BdCache<Device, Lines, LineSize>::find(bd_address_t address) const
+{
+	for (size_t index = 0; index < Lines; index++)
+	{
+		if (lines[index].valid and lines[index].address == address) {
+			return index;
+		}
+	}
+	return Lines;
+}
+
+template <typename Device, size_t Lines, size_t LineSize>
+void
+modm::BdCache<Device, Lines, LineSize>::touch(size_t index)
+{
+	lines[index].lastUse = ++useCounter;
+	if (useCounter == 0)
+	{
+		// keep the order when the counter overflows
+		for (Line& cached : lines) {
+			cached.lastUse = 0;
+		}
+		lines[index].lastUse = useCounter = 1;
+	}
+}
+
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::load(bd_address_t address, bool fill)
+{
+	RF_BEGIN();
+
+	// replace an empty or the least recently used line
+	line = 0;
+	for (size_t index = 0; index < Lines; index++)
+	{
+		if (not lines[index].valid) {
+			line = index;
+			break;
+		}
+		if (lines[index].lastUse < lines[line].lastUse) {
+			line = index;
+		}
+	}
+
+	if (lines[line].valid and lines[line].isDirty())
+	{
+		if (!RF_CALL(flushLine(line))) {
+			RF_RETURN(false);
+		}
+	}
+	lines[line].valid = false;
+
+	if (fill)
+	{
+		if (!RF_CALL(blockDevice.read(lines[line].data, address, LineSize))) {
+			RF_RETURN(false);
+		}
+	}
+
+	lines[line].address = address;
+	lines[line].dirtyBegin = lines[line].dirtyEnd = 0;
+	lines[line].valid = true;
+	touch(line);
+
+	RF_END_RETURN(true);
+}
+
+template <typename Device, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<Device, Lines, LineSize>::flushLine(size_t index)
+{
+	RF_BEGIN();
+
+	if (!RF_CALL(blockDevice.program(&lines[index].data[lines[index].dirtyBegin],
+									 lines[index].address + lines[index].dirtyBegin,
+									 lines[index].dirtyEnd - lines[index].dirtyBegin))) {
+		RF_RETURN(false);
+	}
+	lines[index].dirtyBegin = lines[index].dirtyEnd = 0;
+
+	RF_END_RETURN(true);
+}
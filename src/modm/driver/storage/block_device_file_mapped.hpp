@@ -0,0 +1,134 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_FILE_MAPPED_HPP
+#define MODM_BLOCK_DEVICE_FILE_MAPPED_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+
+#include <modm/processing/resumable.hpp>
+
+namespace modm
+{
+
+/**
+ * \brief	Block device using a memory-mapped file
+ *
+ * Drop-in replacement for `modm::BdFile`, which maps the whole file into
+ * memory instead of seeking and copying through a stream for every call.
+ * Reads and programs are plain memory copies, `getPointer()` gives direct
+ * access to the contents without copying at all.
+ *
+ * Programmed data reaches the file when the kernel writes back the pages,
+ * at the latest on `flush()`, `deinitialize()` or destruction, which call
+ * `msync()`.
+ *
+ * \ingroup	modm_driver_block_device_file_mapped
+ */
+template <class Filename, size_t DeviceSize_>
+class BdFileMapped : public modm::BlockDevice, protected modm::NestedResumable<3>
+{
+public:
+	BdFileMapped() = default;
+	BdFileMapped(const BdFileMapped&) = delete;
+	BdFileMapped& operator= (const BdFileMapped&) = delete;
+
+	/// Writes back and unmaps the file if it is still mapped
+	~BdFileMapped();
+
+	/// Opens and maps the file, which is created if it does not exist
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Writes back and unmaps the file
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  Any block has to be erased prior to being programmed
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  The state of an erased block is undefined until it has been programmed
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks after erasing them
+	*
+	*  The blocks are erased prior to being programmed
+	*
+	*  @param buffer	Buffer of data to write to blocks
+	*  @param address	Address of first block to begin writing to
+	*  @param size		Size to write in bytes (multiple of read block size)
+	*  @return			True on success
+	*/
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/// Synchronously writes all modified pages back to the file
+	modm::ResumableResult<bool>
+	flush();
+
+	/** Direct access to the mapped contents
+	 *
+	 *  The pointer is valid until `deinitialize()` is called.
+	 *
+	 *  @return	Pointer to the data at `address`, or `nullptr` if the range
+	 *  		is outside of the device or the file is not mapped
+	 */
+	const uint8_t*
+	getPointer(bd_address_t address, bd_size_t size = 1) const;
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 1;
+	static constexpr bd_size_t BlockSizeErase = 1;
+	static constexpr bd_size_t DeviceSize = DeviceSize_;
+private:
+	bool
+	map();
+
+	bool
+	unmap();
+
+	uint8_t* data = nullptr;
+	int fd = -1;
+};
+
+}
+#include "block_device_file_mapped_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_FILE_MAPPED_HPP
@@ -0,0 +1,185 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_FILE_MAPPED_HPP
+	#error	"Don't include this file directly, use 'block_device_file_mapped.hpp' instead!"
+#endif
+#include "block_device_file_mapped.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::BdFileMapped<Filename, DeviceSize>::~BdFileMapped()
+{
+	if (data != nullptr) {
+		unmap();
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::ResumableResult<bool>
+modm::BdFileMapped<Filename, DeviceSize>::initialize()
+{
+	RF_BEGIN();
+	RF_END_RETURN(data != nullptr or map());
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::ResumableResult<bool>
+modm::BdFileMapped<Filename, DeviceSize>::deinitialize()
+{
+	RF_BEGIN();
+	RF_END_RETURN(data == nullptr or unmap());
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::ResumableResult<bool>
+modm::BdFileMapped<Filename, DeviceSize>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((data == nullptr) || (size == 0) || (size % BlockSizeRead != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	std::memcpy(buffer, &data[address], size);
+
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::ResumableResult<bool>
+modm::BdFileMapped<Filename, DeviceSize>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((data == nullptr) || (size == 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	std::memcpy(&data[address], buffer, size);
+
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::ResumableResult<bool>
+modm::BdFileMapped<Filename, DeviceSize>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	// erasing does nothing, memory is undefined after erase and has to be programed first
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::ResumableResult<bool>
+modm::BdFileMapped<Filename, DeviceSize>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	if(!RF_CALL(this->erase(address, size))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->program(buffer, address, size));
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+modm::ResumableResult<bool>
+modm::BdFileMapped<Filename, DeviceSize>::flush()
+{
+	RF_BEGIN();
+
+	if(data == nullptr) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN(::msync(data, DeviceSize, MS_SYNC) == 0);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+const uint8_t*
+modm::BdFileMapped<Filename, DeviceSize>::getPointer(bd_address_t address, bd_size_t size) const
+{
+	if((data == nullptr) || (address + size > DeviceSize)) {
+		return nullptr;
+	}
+	return &data[address];
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize>
+bool
+modm::BdFileMapped<Filename, DeviceSize>::map()
+{
+	fd = ::open(Filename::name, O_RDWR | O_CREAT, 0644);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat status;
+	bool success = (::fstat(fd, &status) == 0);
+	if (success and status.st_size != off_t(DeviceSize)) {
+		// create empty file with size of DeviceSize, which reads as zeros
+		success = (status.st_size == 0) and (::ftruncate(fd, DeviceSize) == 0);
+	}
+	if (success) {
+		void* memory = ::mmap(nullptr, DeviceSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (memory != MAP_FAILED) {
+			data = static_cast<uint8_t*>(memory);
+			return true;
+		}
+	}
+	::close(fd);
+	fd = -1;
+	return false;
+}
+
+template <class Filename, size_t DeviceSize>
+bool
+modm::BdFileMapped<Filename, DeviceSize>::unmap()
+{
+	bool success = (::msync(data, DeviceSize, MS_SYNC) == 0);
+	success &= (::munmap(data, DeviceSize) == 0);
+	success &= (::close(fd) == 0);
+	data = nullptr;
+	fd = -1;
+	return success;
+}
@@ -0,0 +1,238 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_file_uring.hpp"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace
+{
+
+int
+ioUringSetup(unsigned entries, io_uring_params* params)
+{
+	return int(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int
+ioUringEnter(int ring, unsigned submit, unsigned minComplete, unsigned flags)
+{
+	return int(::syscall(__NR_io_uring_enter, ring, submit, minComplete, flags, nullptr, 0));
+}
+
+void*
+mapRing(int ring, size_t size, off_t offset)
+{
+	void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+						  MAP_SHARED | MAP_POPULATE, ring, offset);
+	return (memory == MAP_FAILED) ? nullptr : memory;
+}
+
+template< typename T >
+T*
+at(void* base, uint32_t offset)
+{
+	return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+}
+
+}	// anonymous namespace
+
+// ----------------------------------------------------------------------------
+modm::detail::IoUringFile::~IoUringFile()
+{
+	close();
+}
+
+bool
+modm::detail::IoUringFile::open(const char* name, size_t size, unsigned entries)
+{
+	file = ::open(name, O_RDWR | O_CREAT, 0644);
+	if (file < 0) {
+		return false;
+	}
+	struct stat status;
+	bool success = (::fstat(file, &status) == 0);
+	if (success and status.st_size != off_t(size)) {
+		// create empty file with size of DeviceSize, which reads as zeros
+		success = (status.st_size == 0) and (::ftruncate(file, size) == 0);
+	}
+
+	io_uring_params params;
+	std::memset(&params, 0, sizeof(params));
+	if (success) {
+		ring = ioUringSetup(entries, &params);
+		success = (ring >= 0);
+	}
+	if (success)
+	{
+		sqMemorySize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cqMemorySize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		if (params.features & IORING_FEAT_SINGLE_MMAP) {
+			sqMemorySize = cqMemorySize = std::max(sqMemorySize, cqMemorySize);
+		}
+		sqMemory = mapRing(ring, sqMemorySize, IORING_OFF_SQ_RING);
+		if (params.features & IORING_FEAT_SINGLE_MMAP) {
+			cqMemory = sqMemory;
+		} else {
+			cqMemory = mapRing(ring, cqMemorySize, IORING_OFF_CQ_RING);
+		}
+		sqeMemorySize = params.sq_entries * sizeof(io_uring_sqe);
+		sqeMemory = mapRing(ring, sqeMemorySize, IORING_OFF_SQES);
+		success = sqMemory and cqMemory and sqeMemory;
+	}
+	if (not success) {
+		close();
+		return false;
+	}
+
+	sqHead = at<unsigned>(sqMemory, params.sq_off.head);
+	sqTail = at<unsigned>(sqMemory, params.sq_off.tail);
+	sqArray = at<unsigned>(sqMemory, params.sq_off.array);
+	sqMask = *at<unsigned>(sqMemory, params.sq_off.ring_mask);
+	sqEntries = params.sq_entries;
+
+	cqHead = at<unsigned>(cqMemory, params.cq_off.head);
+	cqTail = at<unsigned>(cqMemory, params.cq_off.tail);
+	cqMask = *at<unsigned>(cqMemory, params.cq_off.ring_mask);
+	cqes = at<void>(cqMemory, params.cq_off.cqes);
+
+	queued = inFlight = 0;
+	error = false;
+	return true;
+}
+
+void
+modm::detail::IoUringFile::close()
+{
+	if (sqeMemory) ::munmap(sqeMemory, sqeMemorySize);
+	if (cqMemory and cqMemory != sqMemory) ::munmap(cqMemory, cqMemorySize);
+	if (sqMemory) ::munmap(sqMemory, sqMemorySize);
+	sqeMemory = cqMemory = sqMemory = nullptr;
+
+	if (ring >= 0) ::close(ring);
+	if (file >= 0) ::close(file);
+	ring = file = -1;
+}
+
+// ----------------------------------------------------------------------------
+bool
+modm::detail::IoUringFile::queue(uint8_t opcode, void* buffer, uint64_t offset, uint32_t size,
+								 uint8_t flags)
+{
+	if (ring < 0) {
+		return false;
+	}
+	// completions of all entries must fit into the completion ring,
+	// which is twice as large as the submission ring
+	const unsigned tail = *sqTail;
+	if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries or
+		inFlight + queued >= sqEntries) {
+		return false;
+	}
+
+	io_uring_sqe* const entries = static_cast<io_uring_sqe*>(sqeMemory);
+	// The entries of one batch are executed in any order, so an entry that
+	// overlaps an earlier one of the batch, where either of them writes, is
+	// chained to it. The chain includes all entries queued in between.
+	for (unsigned position = tail - queued; position != tail; position++)
+	{
+		const io_uring_sqe& other = entries[position & sqMask];
+		const bool overlaps = size and other.len and
+				(offset < other.off + other.len) and (other.off < offset + size);
+		if (overlaps and (opcode == IORING_OP_WRITE or other.opcode == IORING_OP_WRITE))
+		{
+			for (; position != tail; position++) {
+				entries[position & sqMask].flags |= IOSQE_IO_LINK;
+			}
+			break;
+		}
+	}
+
+	const unsigned index = tail & sqMask;
+	io_uring_sqe* sqe = entries + index;
+	std::memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = opcode;
+	sqe->flags = flags;
+	sqe->fd = file;
+	sqe->off = offset;
+	sqe->addr = reinterpret_cast<uintptr_t>(buffer);
+	sqe->len = size;
+	// the expected result to detect short reads and writes
+	sqe->user_data = size;
+
+	sqArray[index] = index;
+	__atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+	queued++;
+	return true;
+}
+
+bool
+modm::detail::IoUringFile::submit()
+{
+	while (queued)
+	{
+		const int submitted = ioUringEnter(ring, queued, 0, 0);
+		if (submitted <= 0)
+		{
+			if (submitted < 0 and errno == EINTR) continue;
+			// Withdraw the remaining entries, since the caller may reuse
+			// their buffers once the operation failed. Without SQPOLL, the
+			// kernel only consumes entries during io_uring_enter().
+			__atomic_store_n(sqTail, *sqTail - queued, __ATOMIC_RELEASE);
+			queued = 0;
+			error = true;
+			return false;
+		}
+		queued -= submitted;
+		inFlight += submitted;
+	}
+	return true;
+}
+
+bool
+modm::detail::IoUringFile::poll()
+{
+	unsigned head = *cqHead;
+	unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+	if (head == tail and inFlight)
+	{
+		// runs pending task work, which may post the completions
+		ioUringEnter(ring, 0, 0, IORING_ENTER_GETEVENTS);
+		tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+	}
+	for (; head != tail; head++)
+	{
+		const io_uring_cqe* cqe = static_cast<const io_uring_cqe*>(cqes) + (head & cqMask);
+		if (cqe->res < 0 or uint64_t(cqe->res) != cqe->user_data) {
+			error = true;
+		}
+		inFlight--;
+	}
+	__atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+	return inFlight == 0;
+}
+
+bool
+modm::detail::IoUringFile::getAndClearError()
+{
+	const bool result = error;
+	error = false;
+	return result;
+}
@@ -0,0 +1,216 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_FILE_URING_HPP
+#define MODM_BLOCK_DEVICE_FILE_URING_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+
+#include <modm/processing/resumable.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace modm
+{
+
+namespace detail
+{
+
+/// Minimal io_uring instance using the raw system calls, without liburing
+/// @ingroup	modm_driver_block_device_file_uring
+class IoUringFile
+{
+public:
+	~IoUringFile();
+
+	/// Opens or creates the file with `size` bytes and sets up the rings
+	/// @return	`false` on failure, with `errno` describing the cause
+	bool
+	open(const char* name, size_t size, unsigned entries);
+
+	void
+	close();
+
+	bool
+	isOpen() const
+	{ return ring >= 0; }
+
+	/// Fills a submission queue entry without submitting it.
+	/// Entries overlapping an earlier write of the same batch, or writing to
+	/// the range of an earlier entry, are linked to complete in queue order.
+	bool
+	queue(uint8_t opcode, void* buffer, uint64_t offset, uint32_t size, uint8_t flags = 0);
+
+	/// Submits all queued entries with a single system call
+	bool
+	submit();
+
+	/// Collects completions and returns `true` if none are outstanding
+	bool
+	poll();
+
+	/// @return	`true` if an operation failed since the last call
+	bool
+	getAndClearError();
+
+private:
+	int file{-1};
+	int ring{-1};
+
+	void* sqMemory{nullptr};
+	size_t sqMemorySize{0};
+	void* cqMemory{nullptr};
+	size_t cqMemorySize{0};
+	void* sqeMemory{nullptr};
+	size_t sqeMemorySize{0};
+
+	unsigned* sqHead{nullptr};
+	unsigned* sqTail{nullptr};
+	unsigned* sqArray{nullptr};
+	unsigned sqMask{0};
+	unsigned sqEntries{0};
+
+	unsigned* cqHead{nullptr};
+	unsigned* cqTail{nullptr};
+	unsigned cqMask{0};
+	void* cqes{nullptr};
+
+	unsigned queued{0};
+	unsigned inFlight{0};
+	bool error{false};
+};
+
+}	// namespace detail
+
+/**
+ * \brief	Block device using a file accessed through io_uring
+ *
+ * Drop-in replacement for `modm::BdFile` on Linux. Instead of one blocking
+ * system call per block, requests are placed into the submission ring of
+ * an io_uring instance and the resumable functions yield until the kernel
+ * completes them, so other resumables and fibers keep running meanwhile.
+ *
+ * Several requests can be batched into one system call with `queueRead()`
+ * and `queueProgram()` and completed together with `complete()`:
+ *
+ * \code
+ * for (uint32_t ii = 0; ii < 16; ii++)
+ *     device.queueRead(buffer[ii], ii * 512, 512);
+ * bool success = RF_CALL(device.complete());
+ * \endcode
+ *
+ * The buffers of queued requests must remain valid until `complete()`
+ * returns. Requests of one batch run concurrently, except for overlapping
+ * requests involving a program operation, which complete in queue order.
+ *
+ * \tparam	QueueDepth	Number of requests that can be queued at once
+ *
+ * \ingroup	modm_driver_block_device_file_uring
+ */
+template <class Filename, size_t DeviceSize_, unsigned QueueDepth = 32>
+class BdFileUring : public modm::BlockDevice, protected modm::NestedResumable<3>
+{
+public:
+	/// Opens the file, which is created if it does not exist.
+	/// On failure, `errno` describes the cause, for example `ENOSYS` or
+	/// `EPERM` if io_uring is not available.
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Writes back and closes the file
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  Any block has to be erased prior to being programmed
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  The state of an erased block is undefined until it has been programmed
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks after erasing them
+	*
+	*  The blocks are erased prior to being programmed
+	*
+	*  @param buffer	Buffer of data to write to blocks
+	*  @param address	Address of first block to begin writing to
+	*  @param size		Size to write in bytes (multiple of read block size)
+	*  @return			True on success
+	*/
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/// Waits until all data has been written to the file
+	modm::ResumableResult<bool>
+	flush();
+
+	/** Queues a read without submitting it
+	 *
+	 *  @return	False if the range is invalid or the queue is full
+	 */
+	bool
+	queueRead(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Queues a program operation without submitting it
+	 *
+	 *  @return	False if the range is invalid or the queue is full
+	 */
+	bool
+	queueProgram(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Submits all queued requests and waits for their completion
+	 *
+	 *  @return	True if all requests since the last call succeeded
+	 */
+	modm::ResumableResult<bool>
+	complete();
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 1;
+	static constexpr bd_size_t BlockSizeErase = 1;
+	static constexpr bd_size_t DeviceSize = DeviceSize_;
+private:
+	detail::IoUringFile uring;
+};
+
+}
+#include "block_device_file_uring_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_FILE_URING_HPP
@@ -0,0 +1,169 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_FILE_URING_HPP
+	#error	"Don't include this file directly, use 'block_device_file_uring.hpp' instead!"
+#endif
+#include "block_device_file_uring.hpp"
+
+#include <linux/io_uring.h>
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::initialize()
+{
+	RF_BEGIN();
+	RF_END_RETURN(uring.isOpen() or uring.open(Filename::name, DeviceSize, QueueDepth));
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::deinitialize()
+{
+	RF_BEGIN();
+
+	if(!uring.isOpen()) {
+		RF_RETURN(true);
+	}
+
+	if(!RF_CALL(this->flush())) {
+		uring.close();
+		RF_RETURN(false);
+	}
+	uring.close();
+
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if(!queueRead(buffer, address, size)) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->complete());
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if(!queueProgram(buffer, address, size)) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->complete());
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	// erasing does nothing, memory is undefined after erase and has to be programed first
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	if(!RF_CALL(this->erase(address, size))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->program(buffer, address, size));
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::flush()
+{
+	RF_BEGIN();
+
+	// the file is only synchronized after all queued writes completed
+	if(!uring.queue(IORING_OP_FSYNC, nullptr, 0, 0, IOSQE_IO_DRAIN)) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->complete());
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+bool
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::queueRead(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	if((size == 0) || (size % BlockSizeRead != 0) || (address + size > DeviceSize)) {
+		return false;
+	}
+	return uring.queue(IORING_OP_READ, buffer, address, size);
+}
+
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+bool
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::queueProgram(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	if((size == 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		return false;
+	}
+	return uring.queue(IORING_OP_WRITE, const_cast<uint8_t*>(buffer), address, size);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, unsigned QueueDepth>
+modm::ResumableResult<bool>
+modm::BdFileUring<Filename, DeviceSize, QueueDepth>::complete()
+{
+	RF_BEGIN();
+
+	if(!uring.submit()) {
+		RF_WAIT_UNTIL(uring.poll());
+		uring.getAndClearError();
+		RF_RETURN(false);
+	}
+
+	RF_WAIT_UNTIL(uring.poll());
+
+	RF_END_RETURN(!uring.getAndClearError());
+}
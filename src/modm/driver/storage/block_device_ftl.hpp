@@ -0,0 +1,287 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_FTL_HPP
+#define MODM_BLOCK_DEVICE_FTL_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/processing/resumable.hpp>
+#include <stddef.h>
+#include <type_traits>
+
+namespace modm
+{
+
+/**
+ * \brief	Wear-leveling flash translation layer
+ *
+ * Log-structured block device on top of a flash block device like
+ * `modm::BdSpiFlash`. Logical blocks are never programmed in place, but
+ * appended to the currently open erase block, so that rewriting a block
+ * needs neither an erase nor a read-modify-write of the whole erase block.
+ *
+ * Each erase block starts with a header containing its erase count and is
+ * followed by slots. A slot contains a logical block and a tag with the
+ * logical block number, a sequence number and a CRC. The mapping from
+ * logical to physical blocks is kept in RAM and rebuilt by `initialize()`
+ * from the tags, where the highest sequence number wins. A slot is only
+ * valid once it has been programmed completely, so the previous contents of
+ * a block survive a power loss during `program()`. After a power loss,
+ * programming continues after the last programmed slot, which requires the
+ * flash to read as 0xff when erased. Otherwise, partially programmed erase
+ * blocks are only reused after the garbage collection has erased them.
+ *
+ * Garbage collection copies the remaining valid blocks out of the erase
+ * block with the fewest of them and erases it. If the erase counts of the
+ * erase blocks drift apart by more than `WearLevelingThreshold`, the erase
+ * block with the lowest count is collected instead, to move static data onto
+ * worn blocks. `program()` collects garbage when it runs out of space, but
+ * this adds erase latency to the write. To avoid that, call
+ * `collectGarbage()` ahead of time while `needsGarbageCollection()` returns
+ * true, for example when the application has nothing to write.
+ *
+ * \warning	All functions share one resumable context and their working
+ * 			buffers. `collectGarbage()` must therefore be called from the same
+ * 			protothread or fiber as all other functions, between operations,
+ * 			and never concurrently to a `read()`, `program()` or `erase()`.
+ *
+ * A new device is formatted on demand, since erase blocks without a valid
+ * header are erased before they are used.
+ *
+ * `erase()` only unmaps the logical blocks in RAM, so erased blocks may
+ * return their old contents after the next `initialize()`.
+ *
+ * \warning	Every slot needs `BlockSize` bytes plus a 16 byte tag rounded up to
+ * 			the write block size of the device. For devices with large pages,
+ * 			choose a `BlockSize` which leaves room for the tag, e.g. 240 bytes
+ * 			for 256 byte pages.
+ *
+ * \tparam Device		The flash block device
+ * \tparam BlockSize	Size of a logical block in bytes
+ * \tparam DeviceSize_	Size of the logical device, which must leave at least
+ * 						two erase blocks of the device as spare
+ *
+ * \ingroup	modm_driver_block_device_ftl
+ */
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+class BdFtl : public modm::BlockDevice, protected NestedResumable<4>
+{
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t eraseCount;
+		uint32_t crc;
+	};
+
+	struct Tag
+	{
+		uint32_t block;
+		uint32_t sequence;
+		uint32_t eraseCount;
+		uint32_t crc;
+	};
+
+	static constexpr bd_size_t
+	roundUp(bd_size_t size)
+	{ return ((size + Device::BlockSizeWrite - 1) / Device::BlockSizeWrite) * Device::BlockSizeWrite; }
+
+	static constexpr bd_size_t EraseBlockSize = Device::BlockSizeErase;
+	static constexpr size_t EraseBlocks = Device::DeviceSize / EraseBlockSize;
+	static constexpr bd_size_t HeaderSize = roundUp(sizeof(Header));
+	static constexpr bd_size_t SlotSize = roundUp(BlockSize + sizeof(Tag));
+	static constexpr size_t SlotsPerEraseBlock = (EraseBlockSize - HeaderSize) / SlotSize;
+	static constexpr size_t Blocks = DeviceSize_ / BlockSize;
+	static constexpr size_t Slots = EraseBlocks * SlotsPerEraseBlock;
+
+	static_assert(DeviceSize_ % BlockSize == 0, "DeviceSize must be a multiple of BlockSize!");
+	static_assert(BlockSize % Device::BlockSizeRead == 0 and sizeof(Tag) % Device::BlockSizeRead == 0 and
+			HeaderSize % Device::BlockSizeRead == 0, "BlockSize must be a multiple of the read block size!");
+	static_assert(EraseBlockSize >= HeaderSize + SlotSize, "The erase blocks are too small for BlockSize!");
+	static_assert(Blocks <= (EraseBlocks - 2) * SlotsPerEraseBlock,
+			"DeviceSize must leave at least two spare erase blocks!");
+
+	/// Physical slot or logical block index
+	using Index = std::conditional_t<(Slots < 0xFFFF), uint16_t, uint32_t>;
+	static constexpr Index Unmapped = Index(-1);
+
+public:
+	/// Initializes the storage hardware and reads the mapping from the tags
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Deinitializes the storage hardware
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  Unmapped blocks read as 0xff.
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  Blocks do not need to be erased before, their previous contents are
+	 *  kept until the new contents have been programmed completely.
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of write block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  Unmaps the blocks, which makes their slots available to the garbage
+	 *  collection. The state of an erased block is undefined until it has
+	 *  been programmed.
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of erase block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks after erasing them
+	*
+	*  The blocks are erased prior to being programmed
+	*
+	*  @param buffer	Buffer of data to write to blocks
+	*  @param address	Address of first block to begin writing to
+	*  @param size		Size to write in bytes (multiple of read block size)
+	*  @return			True on success
+	*/
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/// @return	True if `collectGarbage()` has work to do
+	bool
+	needsGarbageCollection() const;
+
+	/** Performs one step of the garbage collection
+	 *
+	 *  Either erases one reclaimed erase block or copies the valid blocks out
+	 *  of one erase block. Must not be called while another operation on
+	 *  this device is in progress.
+	 *
+	 *  @return			False on failure or if there was nothing to do
+	 */
+	modm::ResumableResult<bool>
+	collectGarbage();
+
+public:
+	static constexpr bd_size_t BlockSizeRead = Device::BlockSizeRead;
+	static constexpr bd_size_t BlockSizeWrite = BlockSize;
+	static constexpr bd_size_t BlockSizeErase = BlockSize;
+	static constexpr bd_size_t DeviceSize = DeviceSize_;
+
+	/// Difference of erase counts above which static data is moved
+	static constexpr uint32_t WearLevelingThreshold = 16;
+
+public:
+	/** Direct access to the flash block device
+	*
+	*  @return	Device
+	*/
+	inline Device& getBlockDevice() {return blockDevice;};
+
+private:
+	enum class
+	State : uint8_t
+	{
+		Free,		///< erased with valid header
+		Open,		///< slots are being programmed
+		Closed,		///< no slots left to program
+		Dirty,		///< needs to be erased
+	};
+
+	struct EraseBlock
+	{
+		uint32_t eraseCount;
+		Index valid;
+		State state;
+	};
+
+	static constexpr uint32_t Magic = 0x4c544662;	// "bFTL"
+
+	static constexpr bd_address_t
+	slotAddress(size_t slot)
+	{
+		return (slot / SlotsPerEraseBlock) * EraseBlockSize + HeaderSize +
+			   (slot % SlotsPerEraseBlock) * SlotSize;
+	}
+
+	size_t
+	count(State state) const;
+
+	/// Opens a free erase block if the open one is full
+	bool
+	allocate(bool collecting);
+
+	size_t
+	selectVictim() const;
+
+	/// @return	true if the slot buffer contains a valid slot of the erase block
+	bool
+	isValidSlot(size_t eraseBlock) const;
+
+	/// Mounts the device from the tags of all slots
+	modm::ResumableResult<bool>
+	scan();
+
+	/// Programs the slot buffer into the next slot of the open erase block
+	modm::ResumableResult<bool>
+	programSlot(Index block);
+
+	modm::ResumableResult<bool>
+	eraseBlock(size_t index);
+
+private:
+	Device blockDevice;
+
+	Index map[Blocks];
+	EraseBlock blocks[EraseBlocks];
+	uint32_t sequence;
+	size_t openBlock{EraseBlocks};
+	size_t nextSlot;
+
+	uint8_t slotBuffer[SlotSize];
+	Tag mappedTag;
+
+	// state of the resumable functions
+	bd_address_t position;
+	bd_address_t end;
+	uint8_t* destination;
+	const uint8_t* source;
+	size_t current;
+	size_t scanSlot;
+	size_t slot;
+	size_t written;
+	uint32_t latest;
+	uint32_t openSequence;
+	Index tagBlock;
+	uint32_t tagSequence;
+};
+
+}
+#include "block_device_ftl_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_FTL_HPP
@@ -0,0 +1,453 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_FTL_HPP
+	#error	"Don't include this file directly, use 'block_device_ftl.hpp' instead!"
+#endif
+#include "block_device_ftl.hpp"
+
+#include <modm/math/utils/crc.hpp>
+#include <algorithm>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::initialize()
+{
+	RF_BEGIN();
+
+	if (!RF_CALL(blockDevice.initialize())) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(scan());
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::deinitialize()
+{
+	return blockDevice.deinitialize();
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeRead != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	position = address;
+	end = address + size;
+	destination = buffer;
+
+	while (position < end)
+	{
+		current = std::min<bd_address_t>(end - position, BlockSize - position % BlockSize);
+		if (map[position / BlockSize] == Unmapped) {
+			std::memset(destination, 0xff, current);
+		}
+		else if (!RF_CALL(blockDevice.read(destination,
+				slotAddress(map[position / BlockSize]) + position % BlockSize, current))) {
+			RF_RETURN(false);
+		}
+		position += current;
+		destination += current;
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeWrite != 0) || (address % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	position = address;
+	end = address + size;
+	source = buffer;
+
+	while (position < end)
+	{
+		while (not allocate(false))
+		{
+			if (!RF_CALL(collectGarbage())) {
+				RF_RETURN(false);
+			}
+		}
+		// the garbage collection uses the buffer too
+		std::memcpy(slotBuffer, source, BlockSize);
+		if (!RF_CALL(programSlot(position / BlockSize))) {
+			RF_RETURN(false);
+		}
+		position += BlockSize;
+		source += BlockSize;
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (address % BlockSizeErase != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	for (size_t block = address / BlockSize; block < (address + size) / BlockSize; block++)
+	{
+		if (map[block] != Unmapped)
+		{
+			blocks[map[block] / SlotsPerEraseBlock].valid--;
+			map[block] = Unmapped;
+		}
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (size % BlockSizeWrite != 0)) {
+		RF_RETURN(false);
+	}
+
+	if(!RF_CALL(this->erase(address, size))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->program(buffer, address, size));
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+bool
+modm::BdFtl<Device, BlockSize, DeviceSize_>::needsGarbageCollection() const
+{
+	return (count(State::Dirty) > 0) or (selectVictim() < EraseBlocks);
+}
+
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::collectGarbage()
+{
+	RF_BEGIN();
+
+	// erase reclaimed blocks first, this is the only step that needs no space
+	current = EraseBlocks;
+	for (size_t index = 0; index < EraseBlocks; index++)
+	{
+		if (blocks[index].state == State::Dirty and
+			(current == EraseBlocks or blocks[index].eraseCount < blocks[current].eraseCount)) {
+			current = index;
+		}
+	}
+	if (current < EraseBlocks) {
+		RF_RETURN_CALL(eraseBlock(current));
+	}
+
+	current = selectVictim();
+	if (current == EraseBlocks) {
+		RF_RETURN(false);
+	}
+
+	for (scanSlot = 0; (scanSlot < SlotsPerEraseBlock) and (blocks[current].valid > 0); scanSlot++)
+	{
+		slot = current * SlotsPerEraseBlock + scanSlot;
+		if (!RF_CALL(blockDevice.read(slotBuffer, slotAddress(slot), SlotSize))) {
+			RF_RETURN(false);
+		}
+		if (not isValidSlot(current)) {
+			continue;
+		}
+		{
+			Tag tag;
+			std::memcpy(&tag, &slotBuffer[BlockSize], sizeof(tag));
+			if (map[tag.block] != slot) {
+				continue;
+			}
+			tagBlock = tag.block;
+		}
+		if (not allocate(true)) {
+			RF_RETURN(false);
+		}
+		if (!RF_CALL(programSlot(tagBlock))) {
+			RF_RETURN(false);
+		}
+	}
+	blocks[current].state = State::Dirty;
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+size_t
+modm::BdFtl<Device, BlockSize, DeviceSize_>::count(State state) const
+{
+	return std::count_if(std::begin(blocks), std::end(blocks),
+						 [state](const EraseBlock& block) { return block.state == state; });
+}
+
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+bool
+modm::BdFtl<Device, BlockSize, DeviceSize_>::allocate(bool collecting)
+{
+	// the last free erase block is reserved for the garbage collection
+	const size_t reserved = collecting ? 0 : 1;
+	if (openBlock < EraseBlocks)
+	{
+		if (nextSlot < SlotsPerEraseBlock) {
+			return count(State::Free) >= reserved;
+		}
+		blocks[openBlock].state = State::Closed;
+		openBlock = EraseBlocks;
+	}
+	if (count(State::Free) < reserved + 1) {
+		return false;
+	}
+	for (size_t index = 0; index < EraseBlocks; index++)
+	{
+		if (blocks[index].state == State::Free and
+			(openBlock == EraseBlocks or blocks[index].eraseCount < blocks[openBlock].eraseCount)) {
+			openBlock = index;
+		}
+	}
+	blocks[openBlock].state = State::Open;
+	nextSlot = 0;
+	return true;
+}
+
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+size_t
+modm::BdFtl<Device, BlockSize, DeviceSize_>::selectVictim() const
+{
+	size_t victim = EraseBlocks;
+	size_t coldest = EraseBlocks;
+	uint32_t maximumEraseCount = 0;
+	for (size_t index = 0; index < EraseBlocks; index++)
+	{
+		maximumEraseCount = std::max(maximumEraseCount, blocks[index].eraseCount);
+		if (blocks[index].state != State::Closed) {
+			continue;
+		}
+		if (victim == EraseBlocks or blocks[index].valid < blocks[victim].valid or
+			(blocks[index].valid == blocks[victim].valid and
+			 blocks[index].eraseCount < blocks[victim].eraseCount)) {
+			victim = index;
+		}
+		if (coldest == EraseBlocks or blocks[index].eraseCount < blocks[coldest].eraseCount) {
+			coldest = index;
+		}
+	}
+	// move static data onto the most worn erase blocks, if there is space to
+	// copy a full erase block
+	const size_t space = count(State::Free) * SlotsPerEraseBlock +
+			(openBlock < EraseBlocks ? SlotsPerEraseBlock - nextSlot : 0);
+	if (coldest < EraseBlocks and space >= SlotsPerEraseBlock and
+		maximumEraseCount - blocks[coldest].eraseCount > WearLevelingThreshold) {
+		return coldest;
+	}
+	// reclaim space only if it is needed and possible
+	if (victim < EraseBlocks and
+		(count(State::Free) >= 2 or blocks[victim].valid == SlotsPerEraseBlock)) {
+		return EraseBlocks;
+	}
+	return victim;
+}
+
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+bool
+modm::BdFtl<Device, BlockSize, DeviceSize_>::isValidSlot(size_t eraseBlock) const
+{
+	Tag tag;
+	std::memcpy(&tag, &slotBuffer[BlockSize], sizeof(tag));
+	return (tag.eraseCount == blocks[eraseBlock].eraseCount) and (tag.block < Blocks) and
+		   (tag.crc == modm::math::Crc32::checksum(slotBuffer, BlockSize + offsetof(Tag, crc)));
+}
+
+// ----------------------------------------------------------------------------
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::scan()
+{
+	RF_BEGIN();
+
+	std::fill(std::begin(map), std::end(map), Unmapped);
+	sequence = 0;
+	openBlock = EraseBlocks;
+
+	for (current = 0; current < EraseBlocks; current++)
+	{
+		blocks[current] = {0, 0, State::Dirty};
+		if (!RF_CALL(blockDevice.read(slotBuffer, current * EraseBlockSize, HeaderSize))) {
+			RF_RETURN(false);
+		}
+		{
+			Header header;
+			std::memcpy(&header, slotBuffer, sizeof(header));
+			if (header.magic != Magic or header.crc !=
+				modm::math::Crc32::checksum(slotBuffer, offsetof(Header, crc))) {
+				continue;
+			}
+			blocks[current].eraseCount = header.eraseCount;
+			blocks[current].state = State::Closed;
+		}
+
+		written = 0;
+		latest = 0;
+		for (scanSlot = 0; scanSlot < SlotsPerEraseBlock; scanSlot++)
+		{
+			slot = current * SlotsPerEraseBlock + scanSlot;
+			if (!RF_CALL(blockDevice.read(slotBuffer, slotAddress(slot), SlotSize))) {
+				RF_RETURN(false);
+			}
+			if (std::all_of(std::begin(slotBuffer), std::end(slotBuffer),
+							[](uint8_t value) { return value == 0xff; })) {
+				continue;
+			}
+			written = scanSlot + 1;
+			if (not isValidSlot(current)) {
+				continue;
+			}
+			{
+				Tag tag;
+				std::memcpy(&tag, &slotBuffer[BlockSize], sizeof(tag));
+				tagBlock = tag.block;
+				tagSequence = tag.sequence;
+				sequence = std::max(sequence, tag.sequence + 1);
+				latest = std::max(latest, tag.sequence);
+			}
+			if (map[tagBlock] != Unmapped)
+			{
+				// keep the newer copy
+				if (!RF_CALL(blockDevice.read(reinterpret_cast<uint8_t*>(&mappedTag),
+						slotAddress(map[tagBlock]) + BlockSize, sizeof(Tag)))) {
+					RF_RETURN(false);
+				}
+				if (mappedTag.sequence > tagSequence) {
+					continue;
+				}
+				blocks[map[tagBlock] / SlotsPerEraseBlock].valid--;
+			}
+			map[tagBlock] = slot;
+			blocks[current].valid++;
+		}
+
+		// slots are programmed in order, so the erased slots after the last
+		// programmed one can still be programmed
+		if (written == 0) {
+			blocks[current].state = State::Free;
+		}
+		else if (written < SlotsPerEraseBlock and
+				 (openBlock == EraseBlocks or latest >= openSequence))
+		{
+			// continue with the erase block that was programmed last
+			if (openBlock < EraseBlocks) {
+				blocks[openBlock].state = State::Closed;
+			}
+			openBlock = current;
+			openSequence = latest;
+			nextSlot = written;
+			blocks[current].state = State::Open;
+		}
+	}
+
+	{
+		// erase blocks without valid header have lost their erase count
+		uint32_t maximumEraseCount = 0;
+		for (const EraseBlock& block : blocks) {
+			maximumEraseCount = std::max(maximumEraseCount, block.eraseCount);
+		}
+		for (EraseBlock& block : blocks) {
+			if (block.state == State::Dirty) block.eraseCount = maximumEraseCount;
+		}
+	}
+
+	RF_END_RETURN(true);
+}
+
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::programSlot(Index block)
+{
+	RF_BEGIN();
+
+	slot = openBlock * SlotsPerEraseBlock + nextSlot;
+	// a failed program leaves the slot in an undefined state
+	nextSlot++;
+	{
+		Tag tag{block, sequence++, blocks[openBlock].eraseCount, 0};
+		std::memcpy(&slotBuffer[BlockSize], &tag, sizeof(tag));
+		tag.crc = modm::math::Crc32::checksum(slotBuffer, BlockSize + offsetof(Tag, crc));
+		std::memcpy(&slotBuffer[BlockSize], &tag, sizeof(tag));
+		std::memset(&slotBuffer[BlockSize + sizeof(tag)], 0xff, SlotSize - BlockSize - sizeof(tag));
+	}
+
+	if (!RF_CALL(blockDevice.program(slotBuffer, slotAddress(slot), SlotSize))) {
+		RF_RETURN(false);
+	}
+
+	if (map[block] != Unmapped) {
+		blocks[map[block] / SlotsPerEraseBlock].valid--;
+	}
+	map[block] = slot;
+	blocks[slot / SlotsPerEraseBlock].valid++;
+
+	RF_END_RETURN(true);
+}
+
+template <typename Device, size_t BlockSize, size_t DeviceSize_>
+modm::ResumableResult<bool>
+modm::BdFtl<Device, BlockSize, DeviceSize_>::eraseBlock(size_t index)
+{
+	RF_BEGIN();
+
+	if (!RF_CALL(blockDevice.erase(index * EraseBlockSize, EraseBlockSize))) {
+		RF_RETURN(false);
+	}
+	blocks[index].eraseCount++;
+	{
+		Header header{Magic, blocks[index].eraseCount, 0};
+		std::memcpy(slotBuffer, &header, sizeof(header));
+		header.crc = modm::math::Crc32::checksum(slotBuffer, offsetof(Header, crc));
+		std::memcpy(slotBuffer, &header, sizeof(header));
+		std::memset(&slotBuffer[sizeof(header)], 0xff, HeaderSize - sizeof(header));
+	}
+	if (!RF_CALL(blockDevice.program(slotBuffer, index * EraseBlockSize, HeaderSize))) {
+		RF_RETURN(false);
+	}
+	blocks[index].state = State::Free;
+
+	RF_END_RETURN(true);
+}
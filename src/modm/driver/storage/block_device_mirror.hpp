@@ -25,7 +25,10 @@ namespace modm
  *
  * Write operations (`erase()`, `program()` and `write()`) are forwarded
  * to both block devices.
- * Read operations (`read()`) are only performed on BlockDeviceA.
+ * Read operations (`read()`) alternate between both block devices to balance
+ * the load. If the block devices provide an `isBusy()` function, for example
+ * because they are still erasing or programming, the read is performed on
+ * the other block device if that one is not busy.
  *
  * \tparam BlockDeviceA		First block device of the mirrored block devices
  * \tparam BlockDeviceB		Second block device
@@ -91,7 +94,7 @@ public:
 	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
 
 public:
-	static constexpr bd_size_t BlockSizeRead = BlockDeviceA::BlockSizeRead;
+	static constexpr bd_size_t BlockSizeRead = std::max(BlockDeviceA::BlockSizeRead, BlockDeviceB::BlockSizeRead);
 	static constexpr bd_size_t BlockSizeWrite = std::max(BlockDeviceA::BlockSizeWrite, BlockDeviceB::BlockSizeWrite);
 	static constexpr bd_size_t BlockSizeErase = std::max(BlockDeviceA::BlockSizeErase, BlockDeviceB::BlockSizeErase);
 	static constexpr bd_size_t DeviceSize = std::min(BlockDeviceA::DeviceSize, BlockDeviceB::DeviceSize);
@@ -113,9 +116,22 @@ private:
 	BlockDeviceA blockDeviceA;
 	BlockDeviceB blockDeviceB;
 
+private:
+	/// Forwards to `device.isBusy()`
+	template <typename Device>
+	requires requires (Device& device) { device.isBusy(); }
+	modm::ResumableResult<bool>
+	isDeviceBusy(Device& device);
+
+	/// Devices without `isBusy()` are never busy between operations
+	template <typename Device>
+	modm::ResumableResult<bool>
+	isDeviceBusy(Device& device);
+
 private:
 	bool resultA;
 	bool resultB;
+	bool readFromB = true;
 
 };
 
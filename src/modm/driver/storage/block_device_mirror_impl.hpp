@@ -26,7 +26,7 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::initialize()
 	resultA = RF_CALL(blockDeviceA.initialize());
 	resultB = RF_CALL(blockDeviceB.initialize());
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 // ----------------------------------------------------------------------------
@@ -39,7 +39,7 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::deinitialize()
 	resultA = RF_CALL(blockDeviceA.deinitialize());
 	resultB = RF_CALL(blockDeviceB.deinitialize());
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 // ----------------------------------------------------------------------------
@@ -47,7 +47,24 @@ template <typename BlockDeviceA, typename BlockDeviceB>
 modm::ResumableResult<bool>
 modm::BdMirror<BlockDeviceA, BlockDeviceB>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
-	return blockDeviceA.read(buffer, address, size);
+	RF_BEGIN();
+
+	readFromB = not readFromB;
+	if (readFromB) {
+		if (RF_CALL(isDeviceBusy(blockDeviceB))) {
+			readFromB = RF_CALL(isDeviceBusy(blockDeviceA));
+		}
+	} else {
+		if (RF_CALL(isDeviceBusy(blockDeviceA))) {
+			readFromB = not RF_CALL(isDeviceBusy(blockDeviceB));
+		}
+	}
+
+	if (readFromB) {
+		RF_RETURN_CALL(blockDeviceB.read(buffer, address, size));
+	}
+
+	RF_END_RETURN_CALL(blockDeviceA.read(buffer, address, size));
 }
 
 // ----------------------------------------------------------------------------
@@ -64,7 +81,7 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::program(const uint8_t* buffer, bd_ad
 	resultA = RF_CALL(blockDeviceA.program(buffer, address, size));
 	resultB = RF_CALL(blockDeviceB.program(buffer, address, size));
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 
@@ -82,7 +99,7 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::erase(bd_address_t address, bd_size_
 	resultA = RF_CALL(blockDeviceA.erase(address, size));
 	resultB = RF_CALL(blockDeviceB.erase(address, size));
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 
@@ -100,5 +117,25 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::write(const uint8_t* buffer, bd_addr
 	resultA = RF_CALL(blockDeviceA.write(buffer, address, size));
 	resultB = RF_CALL(blockDeviceB.write(buffer, address, size));
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BlockDeviceA, typename BlockDeviceB>
+template <typename Device>
+requires requires (Device& device) { device.isBusy(); }
+modm::ResumableResult<bool>
+modm::BdMirror<BlockDeviceA, BlockDeviceB>::isDeviceBusy(Device& device)
+{
+	RF_BEGIN();
+	RF_END_RETURN_CALL(device.isBusy());
+}
+
+template <typename BlockDeviceA, typename BlockDeviceB>
+template <typename Device>
+modm::ResumableResult<bool>
+modm::BdMirror<BlockDeviceA, BlockDeviceB>::isDeviceBusy(Device&)
+{
+	RF_BEGIN();
+	RF_END_RETURN(false);
 }
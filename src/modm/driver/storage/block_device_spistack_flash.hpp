@@ -14,7 +14,6 @@
 #define MODM_BLOCK_DEVICE_SPISTACK_FLASH_HPP
 
 #include <algorithm>
-#include <cstdlib>
 
 #include <modm/architecture/interface/block_device.hpp>
 #include <modm/processing/resumable.hpp>
@@ -28,14 +27,30 @@ namespace modm
  * The `read()`, `erase()`,`program()` and `write()` methodes wait for
  * the chip to finish writing to the flash.
  *
+ * By default the dies are concatenated, so that die 0 holds the lowest
+ * `DieSize` bytes. With a non-zero `StripeSize` the dies are striped instead:
+ * consecutive stripes of `StripeSize` bytes are interleaved across all dies.
+ * Since the dies erase and program independently and the SPI block device
+ * does not wait for the last command it issued, an operation spanning
+ * several stripes keeps every die busy at the same time. `write()` erases
+ * the stripes ahead on the other dies while programming the current one.
+ *
  * \tparam SpiBlockDevice		Base SPI block device of the homogenous stack
+ * \tparam DieCount			Number of dies in the stack
+ * \tparam StripeSize		Bytes per die before switching to the next die,
+ *							a multiple of the erase block size, 0 to concatenate
  *
  * \ingroup	modm_driver_block_device_spi_stack_flash
  * \author	Rasmus Kleist Hørlyck Sørensen
  */
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize = 0>
 class BdSpiStackFlash : public modm::BlockDevice, protected NestedResumable<3>
 {
+	static_assert(StripeSize % SpiBlockDevice::BlockSizeErase == 0,
+			"The stripe size must be a multiple of the erase block size!");
+	static_assert(StripeSize == 0 or SpiBlockDevice::DeviceSize % StripeSize == 0,
+			"The die size must be a multiple of the stripe size!");
+
 public:
 	/// Initializes the storage hardware
 	modm::ResumableResult<bool>
@@ -112,8 +127,22 @@ public:
 	static constexpr bd_size_t DeviceSize = DieCount * DieSize;
 
 private:
-	std::ldiv_t dv;
-	uint32_t index;
+	/// Contiguous part of an operation on a single die
+	struct Chunk
+	{
+		bd_address_t address;	///< address on the die
+		bd_size_t size;
+		uint8_t die;
+	};
+
+	/// Maps an address to its die and limits the size to the end of the stripe or die
+	static Chunk
+	locate(bd_address_t address, bd_size_t size);
+
+private:
+	Chunk chunk;
+	bd_size_t index;
+	bd_size_t programIndex;
 	uint8_t currentDie;
 	SpiBlockDevice spiBlockDevice;
 };
@@ -16,9 +16,9 @@
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::initialize()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::initialize()
 {
 	RF_BEGIN();
 
@@ -32,9 +32,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::initialize()
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::deinitialize()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::deinitialize()
 {
 	RF_BEGIN();
 	RF_END_RETURN_CALL(spiBlockDevice.deinitialize());
@@ -42,9 +42,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::deinitialize()
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
@@ -54,12 +54,12 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::read(uint8_t* buffer, bd_addres
 
 	index = 0;
 	while (index < size) {
-		dv = std::ldiv(index + address, DieSize); // dv.quot = die #ID, dv.rem = die address
-		if (currentDie != dv.quot) {
-			RF_CALL(spiBlockDevice.selectDie(currentDie = dv.quot));
+		chunk = locate(address + index, size - index);
+		if (currentDie != chunk.die) {
+			RF_CALL(spiBlockDevice.selectDie(currentDie = chunk.die));
 		}
-		if (RF_CALL(spiBlockDevice.read(&buffer[index], dv.rem, std::min(size - index, DieSize - dv.rem)))) {
-			index += DieSize - dv.rem; // size - index <= DieSize - dv.rem only on last iteration!
+		if (RF_CALL(spiBlockDevice.read(&buffer[index], chunk.address, chunk.size))) {
+			index += chunk.size;
 		} else {
 			RF_RETURN(false);
 		}
@@ -70,9 +70,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::read(uint8_t* buffer, bd_addres
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
@@ -82,12 +82,12 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::program(const uint8_t* buffer,
 
 	index = 0;
 	while (index < size) {
-		dv = std::ldiv(index + address, DieSize); // dv.quot = die #ID, dv.rem = die address
-		if (currentDie != dv.quot) {
-			RF_CALL(spiBlockDevice.selectDie(currentDie = dv.quot));
+		chunk = locate(address + index, size - index);
+		if (currentDie != chunk.die) {
+			RF_CALL(spiBlockDevice.selectDie(currentDie = chunk.die));
 		}
-		if (RF_CALL(spiBlockDevice.program(&buffer[index], dv.rem, std::min(size - index, DieSize - dv.rem)))) {
-			index += DieSize - dv.rem; // size - index <= DieSize - dv.rem only on last iteration!
+		if (RF_CALL(spiBlockDevice.program(&buffer[index], chunk.address, chunk.size))) {
+			index += chunk.size;
 		} else {
 			RF_RETURN(false);
 		}
@@ -98,9 +98,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::program(const uint8_t* buffer,
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::erase(bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::erase(bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
@@ -110,12 +110,12 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::erase(bd_address_t address, bd_
 
 	index = 0;
 	while (index < size) {
-		dv = std::ldiv(index + address, DieSize); // dv.quot = die #ID, dv.rem = die address
-		if (currentDie != dv.quot) {
-			RF_CALL(spiBlockDevice.selectDie(currentDie = dv.quot));
+		chunk = locate(address + index, size - index);
+		if (currentDie != chunk.die) {
+			RF_CALL(spiBlockDevice.selectDie(currentDie = chunk.die));
 		}
-		if (RF_CALL(spiBlockDevice.erase(dv.rem, std::min(size - index, DieSize - dv.rem)))) {
-			index += DieSize - dv.rem; // size - index <= DieSize - dv.rem only on last iteration!
+		if (RF_CALL(spiBlockDevice.erase(chunk.address, chunk.size))) {
+			index += chunk.size;
 		} else {
 			RF_RETURN(false);
 		}
@@ -126,9 +126,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::erase(bd_address_t address, bd_
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
@@ -136,12 +136,35 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::write(const uint8_t* buffer, bd
 		RF_RETURN(false);
 	}
 
-	if(!RF_CALL(this->erase(address, size))) {
-		RF_RETURN(false);
-	}
-
-	if(!RF_CALL(this->program(buffer, address, size))) {
-		RF_RETURN(false);
+	// Erase ahead until the next chunk to erase is on the die that is
+	// programmed next, so that the other dies erase while this one programs
+	index = 0;
+	programIndex = 0;
+	while (programIndex < size)
+	{
+		if (index < size and (index == programIndex or
+				locate(address + index, size - index).die != locate(address + programIndex, size - programIndex).die))
+		{
+			chunk = locate(address + index, size - index);
+			if (currentDie != chunk.die) {
+				RF_CALL(spiBlockDevice.selectDie(currentDie = chunk.die));
+			}
+			if (not RF_CALL(spiBlockDevice.erase(chunk.address, chunk.size))) {
+				RF_RETURN(false);
+			}
+			index += chunk.size;
+		}
+		else
+		{
+			chunk = locate(address + programIndex, size - programIndex);
+			if (currentDie != chunk.die) {
+				RF_CALL(spiBlockDevice.selectDie(currentDie = chunk.die));
+			}
+			if (not RF_CALL(spiBlockDevice.program(&buffer[programIndex], chunk.address, chunk.size))) {
+				RF_RETURN(false);
+			}
+			programIndex += chunk.size;
+		}
 	}
 
 	RF_END_RETURN(true);
@@ -149,9 +172,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::write(const uint8_t* buffer, bd
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::isBusy()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::isBusy()
 {
 	RF_BEGIN();
 
@@ -168,9 +191,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::isBusy()
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
 modm::ResumableResult<void>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::waitWhileBusy()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::waitWhileBusy()
 {
 	RF_BEGIN();
 	while(RF_CALL(isBusy())) {
@@ -178,3 +201,23 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::waitWhileBusy()
 	}
 	RF_END();
 }
+
+// ----------------------------------------------------------------------------
+
+template <typename SpiBlockDevice, uint8_t DieCount, uint32_t StripeSize>
+typename modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::Chunk
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, StripeSize>::locate(bd_address_t address, bd_size_t size)
+{
+	if constexpr (StripeSize == 0)
+	{
+		const bd_address_t offset = address % DieSize;
+		return {offset, std::min(size, DieSize - offset), uint8_t(address / DieSize)};
+	}
+	else
+	{
+		const bd_address_t stripe = address / StripeSize;
+		const bd_address_t offset = address % StripeSize;
+		return {(stripe / DieCount) * StripeSize + offset,
+				std::min(size, StripeSize - offset), uint8_t(stripe % DieCount)};
+	}
+}
@@ -16,6 +16,7 @@
 #define MODM_FIR_HPP
 
 #include <stdint.h>
+#include "fir_kernel.hpp"
 
 namespace modm
 {
@@ -26,6 +27,10 @@ namespace modm
 		 *
 		 * g[n] = SUM(h[k]x[n-k])
 		 *
+		 * The dot product is vectorized for `float`, `int16_t` (Q15) and
+		 * `int32_t` (Q31) taps where the target supports it, see
+		 * modm::filter::fir::dotProduct().
+		 *
 		 * \todo
 		 *
 		 * \author	Kevin Laeufer
@@ -68,6 +73,15 @@ namespace modm
 			void
 			update();
 
+			/**
+			 * \brief	Filters a block of samples
+			 *
+			 * Equivalent to calling append() and update() for each input.
+			 * Afterwards getValue() returns the last output.
+			 */
+			void
+			process(const T (&input)[BLOCK_SIZE], T (&result)[BLOCK_SIZE]);
+
 			/**
 			 * \brief	Returns g[0].
 			 */
@@ -109,25 +109,28 @@ modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::update()
 	printf("\n");
 #endif // FIR_DEBUG_UPDATE
 
-	T sum = (T)0;
-	T *tap = taps + taps_index;
-	for(int i = 0; i < (N - (N%4)); i++){
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i];
-	}
-	for(int i = (N - (N%4)); i < N; i++){
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i];
+#ifdef FIR_DEBUG_UPDATE
+	for(int i = 0; i < N; i++){
+		FIR_DEBUG_SUM(taps[taps_index + i], coefficients[i]);
 	}
+#endif // FIR_DEBUG_UPDATE
+	const T sum = fir::dotProduct<T, N>(taps + taps_index, coefficients);
 	output = sum / ScaleFactor;
 #ifdef FIR_DEBUG_UPDATE
 	printf("sum=%.3f\n", output);
 #endif // FIR_DEBUG_UPDATE
 }
+
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::process(
+		const T (&input)[BLOCK_SIZE], T (&result)[BLOCK_SIZE])
+{
+	for(int i = 0; i < BLOCK_SIZE; i++){
+		append(input[i]);
+		result[i] = fir::dotProduct<T, N>(taps + taps_index, coefficients) / ScaleFactor;
+	}
+	output = result[BLOCK_SIZE - 1];
+}
 #endif // MODM_FIR_IMPL_HPP
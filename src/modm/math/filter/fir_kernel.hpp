@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_FIR_KERNEL_HPP
+#define MODM_FIR_KERNEL_HPP
+
+#include <stdint.h>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE__)
+#	include <immintrin.h>
+#endif
+#if defined(__ARM_FEATURE_SIMD32)
+#	include <arm_acle.h>
+#endif
+
+namespace modm
+{
+	namespace filter
+	{
+		/**
+		 * \brief	Dot product kernels of the FIR filter
+		 *
+		 * The vectorized kernels use SSE/AVX on hosted targets and the DSP
+		 * SIMD instructions on Cortex-M, if the compiler targets them.
+		 * Integer kernels accumulate in 32-bit lanes with wrap-around, and
+		 * therefore return the same result as the scalar kernel, which
+		 * accumulates in `T`. Float kernels sum in a different order, thus
+		 * results may differ in the last bits.
+		 *
+		 * \ingroup modm_math_filter
+		 */
+		namespace fir
+		{
+			/// Sequentially accumulates `tap[i] * coeff[i]` in `T`.
+			template<typename T, int N>
+			T
+			dotProductScalar(const T *tap, const T *coeff);
+
+			/// Vectorized dot product for the target, otherwise dotProductScalar().
+			template<typename T, int N>
+			T
+			dotProduct(const T *tap, const T *coeff);
+
+			/// \c true if dotProduct() is vectorized for `T` on this target.
+			template<typename T>
+			constexpr bool isVectorized =
+#if defined(__AVX__) || defined(__SSE__)
+				std::is_same_v<T, float> or
+#endif
+#if defined(__SSE2__) || defined(__ARM_FEATURE_SIMD32)
+				std::is_same_v<T, int16_t> or
+#endif
+#if defined(__SSE4_1__)
+				std::is_same_v<T, int32_t> or
+#endif
+				false;
+		}
+	}
+}
+
+#include "fir_kernel_impl.hpp"
+
+#endif // MODM_FIR_KERNEL_HPP
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_FIR_KERNEL_HPP
+#	error	"Don't include this file directly, use 'fir_kernel.hpp' instead!"
+#endif
+
+/// @cond
+namespace modm::filter::fir::detail
+{
+
+template<typename T>
+T
+dotProduct(const T *tap, const T *coeff, int n) = delete;
+
+#if defined(__SSE__)
+inline float
+dotProduct(const float *tap, const float *coeff, int n)
+{
+	int i = 0;
+	__m128 acc = _mm_setzero_ps();
+#	if defined(__AVX__)
+	__m256 acc8 = _mm256_setzero_ps();
+	for (; i + 8 <= n; i += 8) {
+		acc8 = _mm256_add_ps(acc8, _mm256_mul_ps(_mm256_loadu_ps(tap + i), _mm256_loadu_ps(coeff + i)));
+	}
+	acc = _mm_add_ps(_mm256_castps256_ps128(acc8), _mm256_extractf128_ps(acc8, 1));
+#	endif
+	for (; i + 4 <= n; i += 4) {
+		acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(tap + i), _mm_loadu_ps(coeff + i)));
+	}
+	acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+	acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+
+	float sum = _mm_cvtss_f32(acc);
+	for (; i < n; i++) {
+		sum += tap[i] * coeff[i];
+	}
+	return sum;
+}
+#endif
+
+#if defined(__SSE2__)
+inline uint32_t
+horizontalSum(__m128i acc)
+{
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+	acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+	return uint32_t(_mm_cvtsi128_si32(acc));
+}
+
+inline int16_t
+dotProduct(const int16_t *tap, const int16_t *coeff, int n)
+{
+	int i = 0;
+	__m128i acc = _mm_setzero_si128();
+#	if defined(__AVX2__)
+	__m256i acc16 = _mm256_setzero_si256();
+	for (; i + 16 <= n; i += 16) {
+		acc16 = _mm256_add_epi32(acc16, _mm256_madd_epi16(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(tap + i)),
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(coeff + i))));
+	}
+	acc = _mm_add_epi32(_mm256_castsi256_si128(acc16), _mm256_extracti128_si256(acc16, 1));
+#	endif
+	for (; i + 8 <= n; i += 8) {
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(tap + i)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(coeff + i))));
+	}
+
+	// accumulating modulo 2^32 and truncating matches the scalar sum in int16_t
+	uint32_t sum = horizontalSum(acc);
+	for (; i < n; i++) {
+		sum += uint32_t(int32_t(tap[i]) * coeff[i]);
+	}
+	return int16_t(sum);
+}
+#elif defined(__ARM_FEATURE_SIMD32)
+inline int16_t
+dotProduct(const int16_t *tap, const int16_t *coeff, int n)
+{
+	int i = 0;
+	int32_t acc = 0;
+	for (; i + 2 <= n; i += 2)
+	{
+		int16x2_t t, c;
+		std::memcpy(&t, tap + i, sizeof(t));
+		std::memcpy(&c, coeff + i, sizeof(c));
+		// SMLAD wraps around on overflow and only sets the Q flag
+		acc = __smlad(t, c, acc);
+	}
+
+	uint32_t sum = uint32_t(acc);
+	for (; i < n; i++) {
+		sum += uint32_t(int32_t(tap[i]) * coeff[i]);
+	}
+	return int16_t(sum);
+}
+#endif
+
+#if defined(__SSE4_1__)
+inline int32_t
+dotProduct(const int32_t *tap, const int32_t *coeff, int n)
+{
+	int i = 0;
+	__m128i acc = _mm_setzero_si128();
+#	if defined(__AVX2__)
+	__m256i acc8 = _mm256_setzero_si256();
+	for (; i + 8 <= n; i += 8) {
+		acc8 = _mm256_add_epi32(acc8, _mm256_mullo_epi32(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(tap + i)),
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(coeff + i))));
+	}
+	acc = _mm_add_epi32(_mm256_castsi256_si128(acc8), _mm256_extracti128_si256(acc8, 1));
+#	endif
+	for (; i + 4 <= n; i += 4) {
+		acc = _mm_add_epi32(acc, _mm_mullo_epi32(
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(tap + i)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(coeff + i))));
+	}
+
+	uint32_t sum = horizontalSum(acc);
+	for (; i < n; i++) {
+		sum += uint32_t(tap[i]) * uint32_t(coeff[i]);
+	}
+	return int32_t(sum);
+}
+#endif
+
+} // namespace modm::filter::fir::detail
+/// @endcond
+
+// -----------------------------------------------------------------------------
+template<typename T, int N>
+T
+modm::filter::fir::dotProductScalar(const T *tap, const T *coeff)
+{
+	T sum = (T)0;
+	for(int i = 0; i < (N - (N%4)); i++){
+		sum += tap[i]*coeff[i]; i++;
+		sum += tap[i]*coeff[i]; i++;
+		sum += tap[i]*coeff[i]; i++;
+		sum += tap[i]*coeff[i];
+	}
+	for(int i = (N - (N%4)); i < N; i++){
+		sum += tap[i]*coeff[i];
+	}
+	return sum;
+}
+
+// -----------------------------------------------------------------------------
+template<typename T, int N>
+T
+modm::filter::fir::dotProduct(const T *tap, const T *coeff)
+{
+	if constexpr (isVectorized<T>) {
+		return detail::dotProduct(tap, coeff, N);
+	} else {
+		return dotProductScalar<T, N>(tap, coeff);
+	}
+}
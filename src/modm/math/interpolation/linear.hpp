@@ -15,6 +15,8 @@
 #define	MODM_INTERPOLATION_LINEAR_HPP
 
 #include <stdint.h>
+#include <cstddef>
+#include <span>
 
 #include <modm/math/utils/arithmetic_traits.hpp>
 #include <modm/container/pair.hpp>
@@ -25,6 +27,14 @@ namespace modm
 	namespace interpolation
 	{
 		/**
+		 * \brief	Linear interpolation between supporting points
+		 *
+		 * The supporting points must be sorted by ascending input value.
+		 * The segment of an input value is found by binary search. If the
+		 * input values of the supporting points are equally spaced, which
+		 * is detected by the constructor or declared with
+		 * `Linear::uniform`, the segment is computed directly instead.
+		 *
 		 * \tparam	T			Any specialization of modm::Pair<>
 		 * \tparam	Accessor	Accessor class. Can be modm::accessor::Ram,
 		 * 						modm::accessor::Flash or any self defined
@@ -44,15 +54,33 @@ namespace modm
 			typedef modm::SignedType< OutputType > OutputSignedType;
 			typedef modm::WideType< OutputSignedType > WideType;
 
+			/// Tag type to declare equally spaced supporting points
+			struct Uniform {};
+			static constexpr Uniform uniform{};
+
 		public:
 			/**
 			 * \brief	Constructor
 			 *
+			 * Checks whether the input values of the supporting points are
+			 * equally spaced.
+			 *
+			 * \param	supportingPoints	Supporting points of the curve.
+			 * 								Needs to be an Array of modm::Pair<>.
+			 * \param	numberOfPoints		length of \p supportingPoints
+			 */
+			Linear(Accessor<T> supportingPoints, std::size_t numberOfPoints);
+
+			/**
+			 * \brief	Constructor for equally spaced supporting points
+			 *
+			 * Skips reading all supporting points for the check.
+			 *
 			 * \param	supportingPoints	Supporting points of the curve.
 			 * 								Needs to be an Array of modm::Pair<>.
 			 * \param	numberOfPoints		length of \p supportingPoints
 			 */
-			Linear(Accessor<T> supportingPoints, uint8_t numberOfPoints);
+			Linear(Accessor<T> supportingPoints, std::size_t numberOfPoints, Uniform);
 
 			/**
 			 * \brief	Perform a linear interpolation
@@ -63,9 +91,42 @@ namespace modm
 			OutputType
 			interpolate(const InputType& value) const;
 
+			/**
+			 * \brief	Perform a linear interpolation of several values
+			 *
+			 * Starts the search for the segment of each value at the segment
+			 * of the previous value, which is fastest for sorted values.
+			 *
+			 * \param 	values	input values
+			 * \param 	results	interpolated values, at least as many as
+			 * 					\p values
+			 */
+			void
+			interpolate(std::span<const InputType> values,
+						std::span<OutputType> results) const;
+
+		private:
+			/// \return	\c true if \p value lies in the segment ending at \p index
+			bool
+			isInSegment(const InputType& value, std::size_t index) const;
+
+			/// \return	index of the first point not below \p value, which
+			///			must be within the supporting points
+			std::size_t
+			findSegment(const InputType& value) const;
+
+			OutputType
+			interpolateSegment(const InputType& value, std::size_t index) const;
+
+			/// \return	distance of equally spaced points, otherwise zero
+			static InputType
+			getUniformStep(Accessor<T> supportingPoints,
+						   std::size_t numberOfPoints, bool check);
+
 		private:
 			const Accessor<T> supportingPoints;
-			const uint8_t numberOfPoints;
+			const std::size_t numberOfPoints;
+			const InputType step;
 		};
 	}
 }
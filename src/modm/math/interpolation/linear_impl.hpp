@@ -19,8 +19,18 @@
 template <typename T,
 		  template <typename> class Accessor>
 modm::interpolation::Linear<T, Accessor>::Linear(
-		Accessor<T> supportingPoints, uint8_t numberOfPoints) :
-	supportingPoints(supportingPoints), numberOfPoints(numberOfPoints)
+		Accessor<T> supportingPoints, std::size_t numberOfPoints) :
+	supportingPoints(supportingPoints), numberOfPoints(numberOfPoints),
+	step(getUniformStep(supportingPoints, numberOfPoints, true))
+{
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+modm::interpolation::Linear<T, Accessor>::Linear(
+		Accessor<T> supportingPoints, std::size_t numberOfPoints, Uniform) :
+	supportingPoints(supportingPoints), numberOfPoints(numberOfPoints),
+	step(getUniformStep(supportingPoints, numberOfPoints, false))
 {
 }
 
@@ -36,30 +46,143 @@ modm::interpolation::Linear<T, Accessor>::interpolate(const InputType& value) co
 		return current.getSecond();
 	}
 
-	T last(current);
-	uint8_t i;
-	for (i = 1; i < this->numberOfPoints; ++i)
-	{
-		current = this->supportingPoints[i];
+	current = this->supportingPoints[this->numberOfPoints - 1];
+	if (value > current.getFirst()) {
+		return current.getSecond();
+	}
+
+	return this->interpolateSegment(value, this->findSegment(value));
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+void
+modm::interpolation::Linear<T, Accessor>::interpolate(
+		std::span<const InputType> values, std::span<OutputType> results) const
+{
+	const T first(this->supportingPoints[0]);
+	const T last(this->supportingPoints[this->numberOfPoints - 1]);
 
-		if (value <= current.getFirst())
+	std::size_t index = 1;
+	for (std::size_t i = 0; i < values.size() and i < results.size(); ++i)
+	{
+		const InputType value = values[i];
+		if (value <= first.getFirst()) {
+			results[i] = first.getSecond();
+		}
+		else if (value > last.getFirst()) {
+			results[i] = last.getSecond();
+		}
+		else
 		{
-			InputType x1_in = last.getFirst();
-			InputType x2_in = current.getFirst();
+			// sorted values mostly stay in the segment or move to the next one
+			if (not this->isInSegment(value, index))
+			{
+				if (index + 1 < this->numberOfPoints and this->isInSegment(value, index + 1)) {
+					index++;
+				} else {
+					index = this->findSegment(value);
+				}
+			}
+			results[i] = this->interpolateSegment(value, index);
+		}
+	}
+}
 
-			OutputType x1_out = last.getSecond();
-			OutputType x2_out = current.getSecond();
+// ----------------------------------------------------------------------------
+template <typename T,
+		  template <typename> class Accessor>
+bool
+modm::interpolation::Linear<T, Accessor>::isInSegment(const InputType& value, std::size_t index) const
+{
+	return (value <= this->supportingPoints[index].getFirst() and
+			value > this->supportingPoints[index - 1].getFirst());
+}
 
-			InputType a = value - x1_in;		// >0
-			WideType b = static_cast<OutputSignedType>(x2_out) -
-						 static_cast<OutputSignedType>(x1_out);
-			InputType c = x2_in - x1_in;		// >0
+template <typename T,
+		  template <typename> class Accessor>
+std::size_t
+modm::interpolation::Linear<T, Accessor>::findSegment(const InputType& value) const
+{
+	if (this->step > 0)
+	{
+		// Points close to the grid need few corrections of the estimate
+		std::size_t index = static_cast<std::size_t>(
+				(value - this->supportingPoints[0].getFirst()) / this->step);
+		index = (index < 1) ? 1 : (index > this->numberOfPoints - 1) ? this->numberOfPoints - 1 : index;
+		while (value > this->supportingPoints[index].getFirst()) {
+			index++;
+		}
+		while (value <= this->supportingPoints[index - 1].getFirst()) {
+			index--;
+		}
+		return index;
+	}
 
-			return static_cast<OutputType>(((a * b) / c) + x1_out);
+	std::size_t low = 1;
+	std::size_t high = this->numberOfPoints - 1;
+	while (low < high)
+	{
+		const std::size_t middle = low + (high - low) / 2;
+		if (value <= this->supportingPoints[middle].getFirst()) {
+			high = middle;
+		} else {
+			low = middle + 1;
 		}
+	}
+	return low;
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+typename modm::interpolation::Linear<T, Accessor>::OutputType
+modm::interpolation::Linear<T, Accessor>::interpolateSegment(const InputType& value, std::size_t index) const
+{
+	const T last(this->supportingPoints[index - 1]);
+	const T current(this->supportingPoints[index]);
+
+	InputType x1_in = last.getFirst();
+	InputType x2_in = current.getFirst();
 
-		last = current;
+	OutputType x1_out = last.getSecond();
+	OutputType x2_out = current.getSecond();
+
+	InputType a = value - x1_in;		// >0
+	WideType b = static_cast<OutputSignedType>(x2_out) -
+				 static_cast<OutputSignedType>(x1_out);
+	InputType c = x2_in - x1_in;		// >0
+
+	return static_cast<OutputType>(((a * b) / c) + x1_out);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  template <typename> class Accessor>
+typename modm::interpolation::Linear<T, Accessor>::InputType
+modm::interpolation::Linear<T, Accessor>::getUniformStep(
+		Accessor<T> supportingPoints, std::size_t numberOfPoints, bool check)
+{
+	if (numberOfPoints < 2) {
+		return 0;
+	}
+
+	const InputType first = supportingPoints[0].getFirst();
+	const InputType step = (supportingPoints[numberOfPoints - 1].getFirst() - first) /
+						   static_cast<InputType>(numberOfPoints - 1);
+	if (not (step > 0)) {
+		return 0;
 	}
 
-	return current.getSecond();
+	// Points less than half a step away from the grid keep the estimate
+	// of findSegment() within one segment
+	for (std::size_t i = 1; check and i < numberOfPoints - 1; ++i)
+	{
+		const InputType point = supportingPoints[i].getFirst();
+		const InputType grid = first + static_cast<InputType>(step * static_cast<InputType>(i));
+		const InputType distance = (point > grid) ? point - grid : grid - point;
+		if (not (distance < step - distance)) {
+			return 0;
+		}
+	}
+	return step;
 }
@@ -13,21 +13,204 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include <modm/architecture/detect.hpp>
 #ifdef __AVR__
 #include <util/crc16.h>
 #endif
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
 
 namespace modm::math
 {
 /// @ingroup modm_math_utils
 /// @{
 
-inline uint8_t
-crc8_ccitt_update(uint8_t crc, uint8_t data)
+/**
+ * Generic CRC engine for byte-aligned widths.
+ *
+ * The CRC register is updated one byte at a time with a 256-entry lookup table
+ * that is computed at compile time. On hosted targets, reflected CRCs process
+ * eight bytes at a time with slicing-by-8 tables and CRC-32C uses the SSE4.2
+ * `crc32` instruction if available. On AVR, the tables are not used to save
+ * RAM, and the assembly routines of avr-libc are used where they exist.
+ *
+ * @tparam Width        width of the CRC in bits: 8, 16 or 32.
+ * @tparam Polynomial    generator polynomial in normal (MSB-first) notation.
+ * @tparam Reflected    `true` if input and output are bit-reflected (LSB-first).
+ * @tparam Init            initial value of the CRC register.
+ * @tparam XorOut        value XORed onto the CRC register by `finalize()`.
+ */
+template< uint8_t Width, uint32_t Polynomial, bool Reflected, uint32_t Init, uint32_t XorOut = 0 >
+class Crc
 {
+    static_assert(Width == 8 or Width == 16 or Width == 32, "Only widths of 8, 16 or 32 bits are supported!");
+
+public:
+    using value_type = std::conditional_t<Width == 8, uint8_t,
+                       std::conditional_t<Width == 16, uint16_t, uint32_t>>;
+
+    static constexpr value_type initial{value_type(Init)};
+
+    /// Updates the CRC register with one byte without lookup table.
+    static constexpr value_type
+    updateBitwise(value_type crc, uint8_t data)
+    {
+        if constexpr (Reflected)
+        {
+            crc ^= data;
+            for (uint_fast8_t ii = 0; ii < 8; ii++)
+                crc = (crc & 1) ? (crc >> 1) ^ reflectedPolynomial : (crc >> 1);
+        }
+        else
+        {
+            crc ^= value_type(value_type(data) << (Width - 8));
+            for (uint_fast8_t ii = 0; ii < 8; ii++)
+                crc = (crc & topBit) ? value_type(crc << 1) ^ value_type(Polynomial) : value_type(crc << 1);
+        }
+        return crc;
+    }
+
+    /// Updates the CRC register with one byte.
+    static constexpr value_type
+    update(value_type crc, uint8_t data)
+    {
 #ifdef __AVR__
-    return _crc8_ccitt_update(crc, data);
+        if (not std::is_constant_evaluated())
+        {
+            if constexpr (Width == 8 and Reflected and Polynomial == 0x31)
+                return _crc_ibutton_update(crc, data);
+            else if constexpr (Width == 16 and Reflected and Polynomial == 0x8005)
+                return _crc16_update(crc, data);
+            else if constexpr (Width == 16 and Reflected and Polynomial == 0x1021)
+                return _crc_ccitt_update(crc, data);
+            else if constexpr (Width == 16 and not Reflected and Polynomial == 0x1021)
+                return _crc_xmodem_update(crc, data);
+        }
+        return updateBitwise(crc, data);
+#else
+        if constexpr (Width == 8)
+            return table[0][uint8_t(crc ^ data)];
+        else if constexpr (Reflected)
+            return (crc >> 8) ^ table[0][uint8_t(crc ^ data)];
+        else
+            return value_type(crc << 8) ^ table[0][uint8_t((crc >> (Width - 8)) ^ data)];
+#endif
+    }
+
+    /// Updates the CRC register with a block of bytes.
+    static value_type
+    update(value_type crc, const uint8_t *data, size_t length)
+    {
+#ifdef __SSE4_2__
+        if constexpr (Width == 32 and Reflected and Polynomial == 0x1EDC6F41)
+        {
+            for (; length >= 8; length -= 8, data += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, data, sizeof(word));
+                crc = uint32_t(_mm_crc32_u64(crc, word));
+            }
+            while (length--) crc = _mm_crc32_u8(crc, *data++);
+            return crc;
+        }
+#endif
+#if defined(MODM_OS_HOSTED) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if constexpr (Reflected)
+        {
+            // slicing-by-8: the CRC register is folded into the first bytes
+            for (; length >= 8; length -= 8, data += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, data, sizeof(word));
+                word ^= crc;
+                crc = table[7][uint8_t(word)]       ^ table[6][uint8_t(word >> 8)] ^
+                      table[5][uint8_t(word >> 16)] ^ table[4][uint8_t(word >> 24)] ^
+                      table[3][uint8_t(word >> 32)] ^ table[2][uint8_t(word >> 40)] ^
+                      table[1][uint8_t(word >> 48)] ^ table[0][uint8_t(word >> 56)];
+            }
+        }
+#endif
+        while (length--) crc = update(crc, *data++);
+        return crc;
+    }
+
+    /// Applies the final XOR to the CRC register.
+    static constexpr value_type
+    finalize(value_type crc)
+    {
+        return crc ^ value_type(XorOut);
+    }
+
+    /// Computes the complete CRC of a block of bytes.
+    static value_type
+    checksum(const uint8_t *data, size_t length)
+    {
+        return finalize(update(initial, data, length));
+    }
+
+private:
+    static constexpr value_type topBit{value_type(1u << (Width - 1))};
+
+    static constexpr value_type
+    reflect(value_type value)
+    {
+        value_type result{0};
+        for (uint_fast8_t ii = 0; ii < Width; ii++, value >>= 1)
+            result = value_type(result << 1) | (value & 1);
+        return result;
+    }
+    static constexpr value_type reflectedPolynomial{reflect(value_type(Polynomial))};
+
+#ifdef MODM_OS_HOSTED
+    static constexpr size_t Slices{Reflected ? 8 : 1};
 #else
+    static constexpr size_t Slices{1};
+#endif
+
+    static constexpr auto
+    makeTable()
+    {
+        std::array<std::array<value_type, 256>, Slices> result{};
+        for (size_t ii = 0; ii < 256; ii++)
+            result[0][ii] = updateBitwise(0, uint8_t(ii));
+        // each slice advances the previous one by a zero byte
+        for (size_t slice = 1; slice < Slices; slice++)
+            for (size_t ii = 0; ii < 256; ii++)
+            {
+                const value_type crc = result[slice - 1][ii];
+                result[slice][ii] = result[0][uint8_t(crc)];
+                if constexpr (Width > 8) result[slice][ii] ^= crc >> 8;
+            }
+        return result;
+    }
+#ifndef __AVR__
+    static constexpr std::array<std::array<value_type, 256>, Slices> table{makeTable()};
+#endif
+};
+
+/// CRC-8/MAXIM-DOW as used by 1-Wire devices (`_crc_ibutton_update()` on AVR).
+using Crc8Maxim = Crc<8, 0x31, true, 0x00>;
+/// CRC-16/MCRF4XX (`_crc_ccitt_update()` on AVR).
+using Crc16Ccitt = Crc<16, 0x1021, true, 0xFFFF>;
+/// CRC-16/XMODEM (`_crc_xmodem_update()` on AVR).
+using Crc16Xmodem = Crc<16, 0x1021, false, 0x0000>;
+/// CRC-16/MODBUS (`_crc16_update()` on AVR).
+using Crc16Modbus = Crc<16, 0x8005, true, 0xFFFF>;
+/// CRC-32/ISO-HDLC as used by Ethernet and zlib.
+using Crc32 = Crc<32, 0x04C11DB7, true, 0xFFFFFFFF, 0xFFFFFFFF>;
+/// CRC-32C (Castagnoli) as used by iSCSI and ext4, accelerated with SSE4.2.
+using Crc32c = Crc<32, 0x1EDC6F41, true, 0xFFFFFFFF, 0xFFFFFFFF>;
+
+/// @cond
+namespace detail
+{
+constexpr uint8_t
+crc8_ccitt_update(uint8_t crc, uint8_t data)
+{
     data ^= crc;
     for (uint8_t ii = 0; ii < 8; ii++)
     {
@@ -35,35 +218,46 @@ crc8_ccitt_update(uint8_t crc, uint8_t data)
         if (data & 0x80) data ^= 0x07;
     }
     return data;
-#endif
 }
 
-inline uint16_t
-crc16_ccitt_update(uint16_t crc, uint8_t data)
+#ifndef __AVR__
+// The update only depends on crc ^ data, so a single table lookup suffices
+constexpr auto crc8_ccitt_table = []
+{
+    std::array<uint8_t, 256> table{};
+    for (size_t ii = 0; ii < 256; ii++) table[ii] = crc8_ccitt_update(0, uint8_t(ii));
+    return table;
+}();
+#endif
+} // namespace detail
+/// @endcond
+
+inline uint8_t
+crc8_ccitt_update(uint8_t crc, uint8_t data)
 {
 #ifdef __AVR__
-    return _crc_ccitt_update(crc, data);
+    return _crc8_ccitt_update(crc, data);
 #else
-    data ^= uint8_t(crc); data ^= data << 4;
-    return (((uint16_t(data) << 8) | uint8_t(crc >> 8)) ^
-            uint8_t(data >> 4) ^ (uint16_t(data) << 3));
+    return detail::crc8_ccitt_table[uint8_t(crc ^ data)];
 #endif
 }
 
+inline uint16_t
+crc16_ccitt_update(uint16_t crc, uint8_t data)
+{
+    return Crc16Ccitt::update(crc, data);
+}
+
 /// @see https://github.com/stbrumme/crc32
 inline uint32_t
 crc32_update(uint32_t crc, uint8_t data)
 {
-    static constexpr uint32_t polynomial{0xEDB88320};
-    crc ^= data;
-    for (uint_fast8_t ii = 0; ii < 8; ii++)
-        crc = (crc >> 1) ^ (-int32_t(crc & 1) & polynomial);
-    return crc;
+    return Crc32::update(crc, data);
 }
 
 static constexpr uint8_t crc8_ccitt_init{0xFFu};
-static constexpr uint16_t crc16_ccitt_init{0xFFFFu};
-static constexpr uint32_t crc32_init{0xFFFFFFFFul};
+static constexpr uint16_t crc16_ccitt_init{Crc16Ccitt::initial};
+static constexpr uint32_t crc32_init{Crc32::initial};
 
 inline uint8_t
 crc8_ccitt(const uint8_t *data, size_t length)
@@ -76,20 +270,15 @@ crc8_ccitt(const uint8_t *data, size_t length)
 inline uint16_t
 crc16_ccitt(const uint8_t *data, size_t length)
 {
-    uint16_t crc{crc16_ccitt_init};
-    while (length--) crc = crc16_ccitt_update(crc, *data++);
-    return crc;
+    return Crc16Ccitt::checksum(data, length);
 }
 
-/// Slow, but table-less computation of CRC32.
+/// Table-driven computation of CRC32.
 inline uint32_t
 crc32(const uint8_t *data, size_t length)
 {
-    uint32_t crc{crc32_init};
-    while (length--) crc = crc32_update(crc, *data++);
-    return ~crc;
+    return Crc32::checksum(data, length);
 }
 
 /// @}
 } // namespace modm::math
-
@@ -31,8 +31,8 @@
 
 static modm::BlockAllocator< MODM_MEMORY_BLOCK_ALLOCATOR_TYPE, MODM_MEMORY_BLOCK_ALLOCATOR_CHUNK_SIZE >
 	allocator;
-// this allocator has a maximum heap size!
-const size_t max_heap_size = (1 << (sizeof(MODM_MEMORY_BLOCK_ALLOCATOR_TYPE) * 8)) *
+// this allocator has a maximum heap size, since free sizes are stored negated!
+const size_t max_heap_size = (1 << (sizeof(MODM_MEMORY_BLOCK_ALLOCATOR_TYPE) * 8 - 1)) *
 							  MODM_MEMORY_BLOCK_ALLOCATOR_CHUNK_SIZE;
 
 extern "C"
@@ -72,19 +72,26 @@ void* __wrap__calloc_r(struct _reent *r, size_t size)
 	return ptr;
 }
 
-void* __wrap__realloc_r(struct _reent *r, void *p, size_t size)
+void __wrap__free_r(struct _reent *r, void *p)
 {
-	if (!p) return __wrap__malloc_r(r, size);
-	// NOT IMPLEMENTED!
-	modm_assert(0, "realloc", "Realloc is not implemented for Block heap!", size);
-	return NULL;
+	__malloc_lock(r);
+	allocator.free(p);
+	__malloc_unlock(r);
 }
 
-void __wrap__free_r(struct _reent *r, void *p)
+void* __wrap__realloc_r(struct _reent *r, void *p, size_t size)
 {
+	if (!p) return __wrap__malloc_r(r, size);
+	if (!size) {
+		__wrap__free_r(r, p);
+		return NULL;
+	}
 	__malloc_lock(r);
-	allocator.free(p);
+	void *ptr = allocator.reallocate(p, size);
 	__malloc_unlock(r);
+	modm_assert_continue_fail_debug(ptr, "realloc",
+			"Unable to realloc in Block heap!", size);
+	return ptr;
 }
 
 } // extern "C"
@@ -17,11 +17,13 @@
 #include <ios>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <fcntl.h>		// file control
 #include <sys/ioctl.h>	// I/O control routines
 #include <termios.h>	// POSIX terminal control
 #include <unistd.h>
+#include <poll.h>
 #include <sys/socket.h>
 
 #include <errno.h>
@@ -246,20 +248,27 @@ modm::platform::SerialInterface::read(char& c)
 	return false;
 }
 
+// ----------------------------------------------------------------------------
+std::size_t
+modm::platform::SerialInterface::read(uint8_t* data, std::size_t length)
+{
+	const ssize_t result = ::read(this->fileDescriptor, data, length);
+	return (result > 0) ? result : 0;
+}
+
 // ----------------------------------------------------------------------------
 void
 modm::platform::SerialInterface::readBytes(uint8_t* data, std::size_t length)
 {
-	int delta = length;
-	int result = 0 ;
-	while (delta > 0)
+	std::size_t count = 0;
+	while (count < length)
 	{
-		result = ::read(this->fileDescriptor, (data + (length - delta)), delta);
-		if (result < 0) {
-			usleep(20);	// swap the thread, so that something could be done while waiting
-			continue;
+		count += this->read(data + count, length - count);
+		// sleep until more data arrives instead of spinning
+		if (count < length and not this->waitFor(POLLIN, -1)) {
+			this->dumpErrorMessage();
+			return;
 		}
-		delta -= result;
 	}
 
 	for (std::size_t i = 0; i < length; i++) {
@@ -268,38 +277,79 @@ modm::platform::SerialInterface::readBytes(uint8_t* data, std::size_t length)
 	MODM_LOG_DEBUG << modm::endl;
 }
 
+// ----------------------------------------------------------------------------
+std::size_t
+modm::platform::SerialInterface::readBytes(uint8_t* data, std::size_t length,
+		std::chrono::milliseconds timeout)
+{
+	const auto deadline = std::chrono::steady_clock::now() + timeout;
+	std::size_t count = 0;
+	while (count < length)
+	{
+		count += this->read(data + count, length - count);
+		if (count == length) break;
+
+		const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+				deadline - std::chrono::steady_clock::now());
+		if (remaining.count() <= 0 or not this->waitFor(POLLIN, remaining.count())) break;
+	}
+	return count;
+}
+
 // ----------------------------------------------------------------------------
 void
 modm::platform::SerialInterface::write(char c)
 {
-/*	SUB_LOGGER_LOG(logger, Logger::ERROR, "writeByte")
-		<< "0x" << std::hex << (int)data << "; ";
- */
-	int reply = ::write(this->fileDescriptor, &c, 1);
-	if (reply <= 0) {
-		this->dumpErrorMessage();
-	}
-//	SUB_LOGGER_LOG( logger, Logger::DEBUG, "writeByte" )
-//		<< "0x" << std::hex << data << " => " << reply << std::dec;
+	this->write(reinterpret_cast<const uint8_t*>(&c), 1);
 }
 
 // ----------------------------------------------------------------------------
 void
 modm::platform::SerialInterface::write(const char* str)
 {
-	char c;
-	while ((c = *str++)) {
-		this->write(c);
+	this->write(reinterpret_cast<const uint8_t*>(str), std::strlen(str));
+}
+
+// ----------------------------------------------------------------------------
+std::size_t
+modm::platform::SerialInterface::write(const uint8_t* data, std::size_t length)
+{
+	std::size_t count = 0;
+	while (count < length)
+	{
+		const ssize_t result = ::write(this->fileDescriptor, data + count, length - count);
+		if (result > 0) {
+			count += result;
+			continue;
+		}
+		if (result < 0 and errno == EINTR) continue;
+		// the port is non-blocking, so wait until the device accepts more data
+		if (result < 0 and errno == EAGAIN and this->waitFor(POLLOUT, -1)) continue;
+
+		this->dumpErrorMessage();
+		break;
 	}
+	return count;
 }
 
 // ----------------------------------------------------------------------------
 void
 modm::platform::SerialInterface::writeBytes(const uint8_t* data, std::size_t length)
 {
-	for (std::size_t i = 0; i < length; ++i) {
-		this->write(static_cast<char>(*data++));
-	}
+	this->write(data, length);
+}
+
+// ----------------------------------------------------------------------------
+bool
+modm::platform::SerialInterface::waitFor(short events, int timeout)
+{
+	struct pollfd descriptor = {this->fileDescriptor, events, 0};
+	int result;
+	do {
+		result = ::poll(&descriptor, 1, timeout);
+	} while (result < 0 and errno == EINTR);
+
+	return (result > 0) and (descriptor.revents & events);
 }
 
 // ----------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include <string>
 #include <stdint.h>
 #include <ostream>
+#include <chrono>
 
 #include <modm/io/iodevice.hpp>
 
@@ -135,14 +136,33 @@ namespace modm
 			read(char& c);
 
 
+			/**
+			 * Read up to length bytes from device without blocking.
+			 *
+			 * @return	number of bytes read
+			 */
+			std::size_t
+			read(uint8_t* data, std::size_t length);
+
 			/**
 			 * Read length bytes from device.
 			 *
-			 * Tries until `length` bytes are read.
+			 * Blocks in `poll()` until `length` bytes are read.
 			 */
 			void
 			readBytes(uint8_t* data, std::size_t length);
 
+			/**
+			 * Read length bytes from device or until the timeout expires.
+			 *
+			 * Blocks in `poll()` while no data is available.
+			 *
+			 * @return	number of bytes read
+			 */
+			std::size_t
+			readBytes(uint8_t* data, std::size_t length,
+					  std::chrono::milliseconds timeout);
+
 			/**
 			 * Write exactly one byte to device.
 			 */
@@ -153,6 +173,15 @@ namespace modm
 			virtual void
 			write(const char* str);
 
+			/**
+			 * Write length bytes to device with as few system calls as
+			 * possible. Blocks in `poll()` while the device buffer is full.
+			 *
+			 * @return	number of bytes written, less than length on error
+			 */
+			std::size_t
+			write(const uint8_t* data, std::size_t length);
+
 			/**
 			 * Write length bytes to device.
 			 */
@@ -181,6 +210,11 @@ namespace modm
 			void
 			dumpErrorMessage();
 
+			/// Waits in `poll()` until one of the events occurs.
+			/// @param	timeout	in milliseconds, negative to wait forever
+			bool
+			waitFor(short events, int timeout);
+
 			bool 			isConnected;	///< Is there an existing connection?
 			std::string 	deviceName;		///< The port (e.g. /dev/ttyS0)
 			unsigned int 	baudRate;
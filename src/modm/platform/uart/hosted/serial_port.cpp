@@ -12,11 +12,70 @@
 // ----------------------------------------------------------------------------
 
 #include "serial_port.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <iostream>
 
-modm::platform::SerialPort::SerialPort():
+// ----------------------------------------------------------------------------
+modm::platform::SerialPort::RingBuffer::RingBuffer(std::size_t capacity) :
+	storage(std::bit_ceil(std::max<std::size_t>(capacity, 1))),
+	mask(storage.size() - 1), head(0), tail(0)
+{
+}
+
+std::size_t
+modm::platform::SerialPort::RingBuffer::push(const uint8_t* data, std::size_t length)
+{
+	length = std::min(length, available());
+	const std::size_t index = tail & mask;
+	const std::size_t first = std::min(length, storage.size() - index);
+	std::memcpy(&storage[index], data, first);
+	std::memcpy(&storage[0], data + first, length - first);
+	tail += length;
+	return length;
+}
+
+std::size_t
+modm::platform::SerialPort::RingBuffer::pop(uint8_t* data, std::size_t length)
+{
+	length = std::min(length, size());
+	const std::size_t index = head & mask;
+	const std::size_t first = std::min(length, storage.size() - index);
+	std::memcpy(data, &storage[index], first);
+	std::memcpy(data + first, &storage[0], length - first);
+	head += length;
+	return length;
+}
+
+std::array<boost::asio::const_buffer, 2>
+modm::platform::SerialPort::RingBuffer::filledSegments() const
+{
+	const std::size_t index = head & mask;
+	const std::size_t first = std::min(size(), storage.size() - index);
+	return {boost::asio::buffer(&storage[index], first),
+			boost::asio::buffer(&storage[0], size() - first)};
+}
+
+std::array<boost::asio::mutable_buffer, 2>
+modm::platform::SerialPort::RingBuffer::freeSegments()
+{
+	const std::size_t index = tail & mask;
+	const std::size_t first = std::min(available(), storage.size() - index);
+	return {boost::asio::buffer(&storage[index], first),
+			boost::asio::buffer(&storage[0], available() - first)};
+}
+
+// ----------------------------------------------------------------------------
+modm::platform::SerialPort::SerialPort(std::size_t bufferSize):
 	shutdown(true),
-	port(io_service)
+	writeBuffer(bufferSize),
+	readBuffer(bufferSize),
+	writeInFlight(0),
+	writeActive(false),
+	readActive(false),
+	port(io_service),
+	thread(nullptr)
 {
 }
 
@@ -28,19 +87,57 @@ modm::platform::SerialPort::~SerialPort()
 void
 modm::platform::SerialPort::write(char c)
 {
-	this->io_service.post(boost::bind(&modm::platform::SerialPort::doWrite, this, c));
+	this->write(reinterpret_cast<const uint8_t*>(&c), 1);
 }
 
+void
+modm::platform::SerialPort::write(const uint8_t* data, std::size_t length)
+{
+	MutexGuard guard(this->writeMutex);
+	while (length and not this->shutdown)
+	{
+		const std::size_t pushed = this->writeBuffer.push(data, length);
+		data += pushed;
+		length -= pushed;
+		if (pushed and not this->writeActive)
+		{
+			this->writeActive = true;
+			this->io_service.post([this]
+			{
+				MutexGuard guard(this->writeMutex);
+				this->writeStart();
+			});
+		}
+		if (length) {
+			this->writeCondition.wait(guard);
+		}
+	}
+}
 
 void
 modm::platform::SerialPort::flush()
 {
+	MutexGuard guard(this->writeMutex);
+	while (this->writeActive and not this->shutdown) {
+		this->writeCondition.wait(guard);
+	}
 }
 
 void
 modm::platform::SerialPort::readStart()
 {
-	port.async_read_some(boost::asio::buffer(&this->tmpRead, sizeof(this->tmpRead)),
+	MutexGuard guard(this->readMutex);
+	this->readContinue();
+}
+
+void
+modm::platform::SerialPort::readContinue()
+{
+	// pause reading until the receive buffer has space again
+	this->readActive = (this->readBuffer.available() != 0) and not this->shutdown;
+	if (not this->readActive) return;
+
+	port.async_read_some(this->readBuffer.freeSegments(),
 			boost::bind(&modm::platform::SerialPort::readComplete,
 					this,
 					boost::asio::placeholders::error,
@@ -50,15 +147,20 @@ modm::platform::SerialPort::readStart()
 bool
 modm::platform::SerialPort::read(char& value)
 {
-	if(this->readBuffer.empty())
-		return false;
-	else
+	return this->read(reinterpret_cast<uint8_t*>(&value), 1) == 1;
+}
+
+std::size_t
+modm::platform::SerialPort::read(uint8_t* data, std::size_t length)
+{
+	MutexGuard queueGuard( this->readMutex);
+	length = this->readBuffer.pop(data, length);
+	if (length and not this->readActive and not this->shutdown)
 	{
-		MutexGuard queueGuard( this->readMutex);
-		value=this->readBuffer.front();
-		this->readBuffer.pop();
-		return true;
+		this->readActive = true;
+		this->io_service.post(boost::bind(&SerialPort::readStart, this));
 	}
+	return length;
 }
 
 bool
@@ -84,6 +186,9 @@ modm::platform::SerialPort::open(std::string deviceName, unsigned int baudRate)
 		this->port.set_option(boost::asio::serial_port_base::character_size(8));
 		this->port.set_option(boost::asio::serial_port_base::stop_bits(boost::asio::serial_port_base::stop_bits::one));
 
+		// keep the service running while reading is paused
+		this->work = std::make_unique<boost::asio::io_service::work>(this->io_service);
+		this->readActive = true;
 		this->io_service.post(boost::bind(&SerialPort::readStart, this));
 
 		this->thread = new boost::thread(boost::bind(&boost::asio::io_service::run, &this->io_service));
@@ -95,7 +200,6 @@ modm::platform::SerialPort::open(std::string deviceName, unsigned int baudRate)
 	return true;
 }
 
-
 bool
 modm::platform::SerialPort::isOpen()
 {
@@ -141,61 +245,67 @@ modm::platform::SerialPort::doAbort(const boost::system::error_code& error)
 	if (error)
 		std::cerr << "Error: " << error.message() << std::endl;
 	this->port.close();
-	if (error)
-		std::cerr << "Error: " << error.message() << std::endl;
+	this->work.reset();
+	{
+		// wake up writers waiting for buffer space or a flush
+		MutexGuard guard(this->writeMutex);
+		this->shutdown = true;
+	}
+	this->writeCondition.notify_all();
 }
 
 void
 modm::platform::SerialPort::doClose(const boost::system::error_code& error)
 {
-	if( this->writeBuffer.empty() ) {
-		this->doAbort(error);
-	}
-	this->shutdown = true;
-}
-
-void
-modm::platform::SerialPort::doWrite(const char c) {
-	if (!this->shutdown)
+	bool idle;
 	{
-		std::cout<<"get 0x"<< std::hex << (int) c << std::dec
-		<< "(" << c << ")" << std::endl;
-
-		MutexGuard mutex(this->writeMutex);
-		bool idle = this->writeBuffer.empty();
-		this->writeBuffer.push(c);
-
-		if (idle) {
-			this->writeStart();
-		}
+		MutexGuard guard(this->writeMutex);
+		idle = not this->writeActive;
+		this->shutdown = true;
+	}
+	if (idle) {
+		this->doAbort(error);
 	}
 }
 
 void
 modm::platform::SerialPort::writeStart(void)
 {
+	// transmit all queued bytes, which may wrap around the end of the buffer
+	this->writeInFlight = this->writeBuffer.size();
 	boost::asio::async_write(this->port,
-			boost::asio::buffer(&this->writeBuffer.front(), 1),
+			this->writeBuffer.filledSegments(),
 			boost::bind(&modm::platform::SerialPort::writeComplete, this,
-					boost::asio::placeholders::error));
+					boost::asio::placeholders::error,
+					boost::asio::placeholders::bytes_transferred));
 }
 
 void
-modm::platform::SerialPort::writeComplete(const boost::system::error_code& error)
+modm::platform::SerialPort::writeComplete(const boost::system::error_code& error, size_t bytes_transferred)
 {
 	if (!error) {
-		MutexGuard mutex(this->writeMutex);
-		this->writeBuffer.pop();
-		if (!this->writeBuffer.empty()) {
-			std::cout << "restart " << this->writeBuffer.size() << std::endl;
-			this->writeStart();
+		bool done;
+		{
+			MutexGuard mutex(this->writeMutex);
+			this->writeBuffer.consume(bytes_transferred);
+			this->writeInFlight = 0;
+			done = this->writeBuffer.isEmpty();
+			if (not done) {
+				this->writeStart();
+			}
+			this->writeActive = not done;
 		}
-		else if (this->shutdown) {
+		this->writeCondition.notify_all();
+		if (done and this->shutdown) {
 			this->doAbort(error);
 		}
 	}
 	else {
 		std::cerr << "Error in write: " << error.message() << std::endl;
+		{
+			MutexGuard mutex(this->writeMutex);
+			this->writeActive = false;
+		}
 		this->doAbort(error);
 	}
 }
@@ -205,20 +315,19 @@ modm::platform::SerialPort::readComplete(const boost::system::error_code& error,
 {
     if (!error)
     {
-    	{
-			MutexGuard queueGuard( this->readMutex);
-			for(unsigned int i=0; i<bytes_transferred; ++i)
-			{
-				std::cout<<"get 0x"<< std::hex << (int) this->tmpRead[i] << std::dec
-				<< "(" << this->tmpRead[i] << ")" << std::endl;
-				this->readBuffer.push(this->tmpRead[i]);
-			}
-    	}
-        this->readStart();
+		MutexGuard queueGuard( this->readMutex);
+		this->readBuffer.commit(bytes_transferred);
+		this->readContinue();
     }
     else
     {
-		doClose(error);
+		{
+			MutexGuard queueGuard( this->readMutex);
+			this->readActive = false;
+		}
+		// closing the port cancels the pending read
+		doClose(error == boost::asio::error::operation_aborted ?
+				boost::system::error_code() : error);
     }
 }
 
@@ -226,15 +335,20 @@ void
 modm::platform::SerialPort::clearReadBuffer()
 {
 	MutexGuard queueGuard( this->readMutex);
-	while(!this->readBuffer.empty()) {
-		this->readBuffer.pop();
+	// only drop bytes from the front, the pending read writes behind them
+	this->readBuffer.consume(this->readBuffer.size());
+	if (not this->readActive and not this->shutdown)
+	{
+		this->readActive = true;
+		this->io_service.post(boost::bind(&SerialPort::readStart, this));
 	}
 }
 
 void
 modm::platform::SerialPort::clearWriteBuffer()
 {
-	while(!this->writeBuffer.empty()) {
-		this->writeBuffer.pop();
-	}
+	MutexGuard guard(this->writeMutex);
+	// the bytes of the current write operation must stay valid
+	this->writeBuffer.truncate(this->writeInFlight);
+	this->writeCondition.notify_all();
 }
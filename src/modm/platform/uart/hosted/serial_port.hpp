@@ -16,11 +16,16 @@
 #define MODM_HOSTED_SERIAL_PORT_HPP
 
 #include <string>
-#include <queue>
+#include <array>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
 #include <utility>
 #include <boost/asio.hpp>
 #include <boost/bind/bind.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 #include <boost/thread.hpp>
 
 #include <modm/io/iodevice.hpp>
@@ -34,13 +39,21 @@ namespace modm
 		 *
 		 * Port is closed right after construction.
 		 *
+		 * Written and received bytes are stored in contiguous ring buffers.
+		 * All pending bytes are transmitted with a single scatter/gather write
+		 * and received bytes are read directly into the free space of the
+		 * receive buffer. Writing blocks while the transmit buffer is full,
+		 * reading from the port pauses while the receive buffer is full.
+		 *
 		 * \ingroup	modm_platform_uart
 		 */
 		class SerialPort : IODevice
 		{
 		public :
 
-			SerialPort();
+			/// \param	bufferSize	capacity of the transmit and receive
+			///						buffer, rounded up to a power of two
+			SerialPort(std::size_t bufferSize = 1 << 16);
 
 			~SerialPort();
 
@@ -49,12 +62,22 @@ namespace modm
 			virtual void
 			write(char c);
 
+			/// Queues `length` bytes for transmission.
+			/// Blocks while the transmit buffer is full.
+			void
+			write(const uint8_t* data, std::size_t length);
+
+			/// Blocks until all queued bytes are transmitted.
 			virtual void
 			flush();
 
 			virtual bool
 			read(char& value);
 
+			/// \return	number of received bytes copied into `data`
+			std::size_t
+			read(uint8_t* data, std::size_t length);
+
 			virtual bool
 			open( std::string deviceName, unsigned int baudRate );
 
@@ -77,37 +100,95 @@ namespace modm
 			typedef boost::mutex				Mutex;
 			typedef boost::mutex::scoped_lock	MutexGuard;
 
-			bool shutdown;
+			/// Byte ring with a power-of-two capacity, which exposes its filled
+			/// and free regions as up to two contiguous segments each.
+			class RingBuffer
+			{
+			public:
+				explicit
+				RingBuffer(std::size_t capacity);
+
+				std::size_t
+				size() const { return tail - head; }
+
+				std::size_t
+				available() const { return storage.size() - size(); }
+
+				bool
+				isEmpty() const { return head == tail; }
+
+				/// Copies as many bytes as fit into the free space
+				std::size_t
+				push(const uint8_t* data, std::size_t length);
+
+				/// Copies at most `length` bytes out of the filled space
+				std::size_t
+				pop(uint8_t* data, std::size_t length);
+
+				/// Drops `length` bytes from the front
+				void
+				consume(std::size_t length) { head += length; }
+
+				/// Appends `length` bytes written into the free segments
+				void
+				commit(std::size_t length) { tail += length; }
+
+				/// Drops all bytes except the first `keep` ones
+				void
+				truncate(std::size_t keep) { tail = head + keep; }
+
+				std::array<boost::asio::const_buffer, 2>
+				filledSegments() const;
+
+				std::array<boost::asio::mutable_buffer, 2>
+				freeSegments();
+
+			private:
+				std::vector<uint8_t> storage;
+				std::size_t mask;
+				// free running positions, wrapped with the mask on access
+				std::size_t head;
+				std::size_t tail;
+			};
+
+			std::atomic<bool> shutdown;
 			std::string deviceName;
 			unsigned int baudRate;
 			Mutex readMutex;
 			Mutex writeMutex;
+			boost::condition_variable writeCondition;
 
-			char tmpRead[512];
-			std::queue<char> writeBuffer;
-			std::queue<char> readBuffer;
+			RingBuffer writeBuffer;
+			RingBuffer readBuffer;
+			/// Number of bytes of the current write operation
+			std::size_t writeInFlight;
+			bool writeActive;
+			bool readActive;
 
 			boost::asio::io_service  io_service;
 			boost::asio::serial_port port;
+			std::unique_ptr<boost::asio::io_service::work> work;
 			boost::thread* 			 thread;
 
 			void
 			readStart();
 
+			/// Requires readMutex to be locked
+			void
+			readContinue();
+
 	        void
 	        doClose(const boost::system::error_code& error);
 
 	        void
 	        doAbort(const boost::system::error_code& error);
 
-	        void
-	        doWrite(const char c);
-
+	        /// Requires writeMutex to be locked
 	        void
 	        writeStart(void);
 
 	        void
-	        writeComplete(const boost::system::error_code& error);
+	        writeComplete(const boost::system::error_code& error, size_t bytes_transferred);
 
 			void
 			readComplete(const boost::system::error_code& error, size_t bytes_transferred);
@@ -92,16 +92,8 @@ template<int N>
 std::size_t
 modm::platform::StaticSerialInterface<N>::read(uint8_t *data, std::size_t length)
 {
-	// Check how many bytes are available before reading to
-	// avoid a blocking access.
-	std::size_t available = backend->bytesAvailable();
-	if (available < length) {
-		length = available;
-	}
-
-	backend->readBytes(data, length);
-
-	return length;
+	// Non-blocking read of the available bytes
+	return backend->read(data, length);
 }
 
 template<int N>
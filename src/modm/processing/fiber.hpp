@@ -28,3 +28,7 @@ function returns immediately, thus blocks in-place.
 #if __has_include("fiber/task.hpp")
 #	include "fiber/task.hpp"
 #endif
+// multi-threaded scheduling on hosted targets
+#if __has_include("fiber/worker_pool.hpp")
+#	include "fiber/worker_pool.hpp"
+#endif
@@ -13,6 +13,7 @@
 
 #include "functions.hpp"
 #include "stop_token.hpp"
+#include "wait_queue.hpp"
 #include <atomic>
 
 
@@ -37,6 +38,7 @@ class condition_variable_any
 	condition_variable_any& operator=(const condition_variable_any&) = delete;
 
 	std::atomic<uint16_t> sequence{};
+	WaitQueue waiters;
 
 	const auto inline wait_on_sequence()
 	{
@@ -51,13 +53,22 @@ public:
 	notify_one()
 	{
 		sequence.fetch_add(1, std::memory_order_release);
+		waiters.notify_one();
+	}
+
+	/// @note This function can be called from an interrupt.
+	void inline
+	notify_all()
+	{
+		sequence.fetch_add(1, std::memory_order_release);
+		waiters.notify_all();
 	}
 
 	/// @note This function can be called from an interrupt.
 	void inline
 	notify_any()
 	{
-		notify_one();
+		notify_all();
 	}
 
 
@@ -65,8 +76,9 @@ public:
 	void
 	wait(Lock& lock)
 	{
+		auto notified = wait_on_sequence();
 		lock.unlock();
-		this_fiber::poll(wait_on_sequence());
+		waiters.wait(notified);
 		lock.lock();
 	}
 
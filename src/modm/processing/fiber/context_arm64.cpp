@@ -119,7 +119,8 @@ modm_context_stack_overflow(const modm_context_t *ctx)
 	return *ctx->bottom != StackWatermark;
 }
 
-static modm_context_t main_context;
+// Every thread needs its own main context to start fibers
+static thread_local modm_context_t main_context;
 
 void
 modm_context_start(modm_context_t *to)
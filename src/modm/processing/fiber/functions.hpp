@@ -24,6 +24,15 @@ namespace modm::fiber
 /// @ingroup modm_processing_fiber
 using id = uintptr_t;
 
+/// @cond
+// Suspends the current fiber until the clock has advanced by the duration
+void
+suspend_for(modm::chrono::milli_clock::duration duration);
+
+void
+suspend_for(modm::chrono::micro_clock::duration duration);
+/// @endcond
+
 } // namespace modm::fiber
 
 namespace modm::this_fiber
@@ -134,32 +143,63 @@ poll_until(std::chrono::time_point<Clock, Duration> sleep_time, Function &&condi
 }
 
 /**
- * Yields the current fiber until the time duration has elapsed.
+ * Suspends the current fiber until the time duration has elapsed.
+ *
+ * The fiber is removed from the scheduler while sleeping, so that it does not
+ * consume any processing time. A zero or negative duration only yields once.
  *
  * @note For nanosecond delays, use `modm::delay(ns)`.
- * @note Due to the overhead of `yield()` and the scheduling other fibers, the
- *       sleep duration may be longer without any guarantee of an upper limit.
+ * @note Due to the scheduling of other fibers, the sleep duration may be longer
+ *       without any guarantee of an upper limit.
  * @see https://en.cppreference.com/w/cpp/thread/sleep_for
  */
 template< class Rep, class Period >
 void
 sleep_for(std::chrono::duration<Rep, Period> sleep_duration)
 {
-	(void) poll_for(sleep_duration, []{ return false; });
+	if (sleep_duration <= sleep_duration.zero())
+	{
+		modm::this_fiber::yield();
+		return;
+	}
+
+	// Only choose the microsecond clock if necessary
+	using Clock = std::conditional_t<
+		std::is_convertible_v<std::chrono::duration<Rep, Period>,
+							  std::chrono::duration<Rep, std::milli>>,
+		modm::chrono::milli_clock, modm::chrono::micro_clock>;
+
+	// Ensure the sleep duration is rounded up to the next full clock tick
+	modm::fiber::suspend_for(std::chrono::ceil<typename Clock::duration>(sleep_duration));
 }
 
 /**
- * Yields the current fiber until the sleep time has been reached.
+ * Suspends the current fiber until the sleep time has been reached.
  *
- * @note Due to the overhead of `yield()` and the scheduling other fibers, the
- *       sleep duration may be longer without any guarantee of an upper limit.
+ * For the `modm::Clock` and `modm::PreciseClock` the fiber is removed from the
+ * scheduler while sleeping, so that it does not consume any processing time.
+ * For other clocks the fiber yields until the sleep time has been reached.
+ * A sleep time in the past only yields once.
+ *
+ * @note Due to the scheduling of other fibers, the sleep duration may be longer
+ *       without any guarantee of an upper limit.
  * @see https://en.cppreference.com/w/cpp/thread/sleep_until
  */
 template< class Clock, class Duration >
 void
 sleep_until(std::chrono::time_point<Clock, Duration> sleep_time)
 {
-	(void) poll_until(sleep_time, []{ return false; });
+	if constexpr (std::is_same_v<Clock, modm::chrono::milli_clock> or
+				  std::is_same_v<Clock, modm::chrono::micro_clock>)
+	{
+		// The clocks wrap around, so the sleep duration is signed
+		const auto sleep_duration = std::chrono::ceil<typename Clock::duration>(
+				sleep_time - Clock::now());
+		if (int32_t(sleep_duration.count()) > 0)
+			modm::fiber::suspend_for(sleep_duration);
+		else modm::this_fiber::yield();
+	}
+	else (void) poll_until(sleep_time, []{ return false; });
 }
 
 /// @}
@@ -17,6 +17,7 @@
 #endif
 
 #include "functions.hpp"
+#include "wait_queue.hpp"
 #include <modm/architecture/interface/atomic_lock.hpp>
 #include <limits>
 #include <atomic>
@@ -36,6 +37,7 @@ class mutex
 	mutex& operator=(const mutex&) = delete;
 
 	std::atomic_bool locked{false};
+	WaitQueue waiters;
 public:
 	constexpr mutex() = default;
 
@@ -50,7 +52,8 @@ public:
 	void inline
 	lock()
 	{
-		while(not try_lock()) modm::this_fiber::yield();
+		while(not try_lock())
+			waiters.wait([this]{ return not locked.load(std::memory_order_relaxed); });
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -58,6 +61,7 @@ public:
 	unlock()
 	{
 		locked.store(false, std::memory_order_release);
+		waiters.notify_one();
 	}
 };
 
@@ -95,6 +99,7 @@ class recursive_mutex
 	volatile fiber::id owner{NoOwner};
 	static constexpr count_t countMax{count_t(-1)};
 	volatile count_t count{1};
+	WaitQueue waiters;
 
 public:
 	constexpr recursive_mutex() = default;
@@ -121,19 +126,20 @@ public:
 	void inline
 	lock()
 	{
-		while(not try_lock()) modm::this_fiber::yield();
+		while(not try_lock()) waiters.wait([this]{ return owner == NoOwner; });
 	}
 
 	/// @note This function can be called from an interrupt.
 	void inline
 	unlock()
 	{
-		modm::atomic::Lock _;
-		if (count > 1) count--;
-		else {
+		{
+			modm::atomic::Lock _;
+			if (count > 1) { count--; return; }
 			// count = 1; is implicit
 			owner = NoOwner;
 		}
+		waiters.notify_one();
 	}
 };
 
@@ -28,4 +28,25 @@ get_id()
 }
 
 } // namespace modm::this_fiber
+
+namespace modm::fiber
+{
+
+void inline
+suspend_for(modm::chrono::milli_clock::duration duration)
+{
+	// block in-place
+	const auto start = modm::chrono::milli_clock::now();
+	while ((modm::chrono::milli_clock::now() - start) < duration) ;
+}
+
+void inline
+suspend_for(modm::chrono::micro_clock::duration duration)
+{
+	// block in-place
+	const auto start = modm::chrono::micro_clock::now();
+	while ((modm::chrono::micro_clock::now() - start) < duration) ;
+}
+
+} // namespace modm::fiber
 /// @endcond
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "scheduler.hpp"
+#include <cerrno>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/// @cond
+namespace modm::fiber
+{
+
+static constexpr uint32_t AlwaysReported = EPOLLERR | EPOLLHUP;
+
+Reactor::~Reactor()
+{
+	if (epfd >= 0) ::close(epfd);
+}
+
+uint32_t
+Reactor::wait(int fd, uint32_t events)
+{
+	Scheduler& scheduler = Scheduler::instance();
+	if (scheduler.current == nullptr)
+	{
+		// Without a scheduler the thread itself must block
+		struct pollfd pfd{fd, short(events), 0};
+		while (::poll(&pfd, 1, -1) < 0)
+			if (errno != EINTR) return 0;
+		if (pfd.revents & POLLNVAL) return 0;
+		return uint32_t(pfd.revents);
+	}
+	return scheduler.reactor.suspend(fd, events);
+}
+
+uint32_t
+Reactor::suspend(int fd, uint32_t events)
+{
+	if (epfd < 0 and (epfd = ::epoll_create1(EPOLL_CLOEXEC)) < 0) return 0;
+
+	const uint32_t previous = eventsOf(fd);
+	if (not update(fd, previous, previous | events))
+	{
+		// epoll does not support regular files, which are always ready
+		return (errno == EPERM) ? events : 0;
+	}
+
+	Scheduler& scheduler = Scheduler::instance();
+	Waiter waiter{scheduler.current, waiters, fd, events, 0};
+	waiters = &waiter;
+	scheduler.suspend();
+	return waiter.revents;
+}
+
+void
+Reactor::poll(int timeout)
+{
+	if (epfd < 0) return;
+	Scheduler& scheduler = Scheduler::instance();
+	struct epoll_event events[16];
+	const int count = ::epoll_wait(epfd, events, 16, timeout);
+	for (int ii = 0; ii < count; ii++)
+	{
+		const int fd = events[ii].data.fd;
+		const uint32_t previous = eventsOf(fd);
+		for (Waiter** waiter = &waiters; *waiter;)
+		{
+			Waiter& w = **waiter;
+			const uint32_t revents = events[ii].events & (w.events | AlwaysReported);
+			if (w.fd != fd or not revents)
+			{
+				waiter = &w.next;
+				continue;
+			}
+			// unlink the waiter before its fiber can return and destroy it
+			*waiter = w.next;
+			w.revents = revents;
+			scheduler.resume(*w.task);
+		}
+		update(fd, previous, eventsOf(fd));
+	}
+}
+
+uint32_t
+Reactor::eventsOf(int fd) const
+{
+	uint32_t events{0};
+	for (const Waiter* waiter = waiters; waiter; waiter = waiter->next)
+		if (waiter->fd == fd) events |= waiter->events;
+	return events;
+}
+
+bool
+Reactor::update(int fd, uint32_t previous, uint32_t events)
+{
+	if (previous == events) return true;
+	const int op = previous ? (events ? EPOLL_CTL_MOD : EPOLL_CTL_DEL) : EPOLL_CTL_ADD;
+	struct epoll_event event{};
+	event.events = events;
+	event.data.fd = fd;
+	return ::epoll_ctl(epfd, op, fd, &event) == 0;
+}
+
+} // namespace modm::fiber
+
+namespace modm::this_fiber
+{
+
+bool
+wait_readable(int fd)
+{
+	return modm::fiber::Reactor::wait(fd, EPOLLIN);
+}
+
+bool
+wait_writable(int fd)
+{
+	return modm::fiber::Reactor::wait(fd, EPOLLOUT);
+}
+
+} // namespace modm::this_fiber
+/// @endcond
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace modm::fiber
+{
+
+// forward declaration
+class Task;
+
+/**
+ * Suspends fibers until their file descriptors become ready.
+ *
+ * Every scheduler owns an epoll instance, which is only created once the first
+ * fiber waits on a file descriptor. Waiting fibers are removed from the ring of
+ * the scheduler, so that they do not consume any processing time. The reactor
+ * is polled periodically while other fibers are running, and if all fibers are
+ * waiting, the scheduler blocks the thread in `epoll_wait()` instead.
+ *
+ * @ingroup modm_processing_fiber
+ */
+class Reactor
+{
+	friend class Scheduler;
+	Reactor(const Reactor&) = delete;
+	Reactor& operator=(const Reactor&) = delete;
+
+	struct Waiter
+	{
+		Task* task;
+		Waiter* next;
+		int fd;
+		uint32_t events;
+		uint32_t revents;
+	};
+
+public:
+	constexpr Reactor() = default;
+	~Reactor();
+
+	/// Suspends the current fiber until any of the `epoll` events occur.
+	/// @returns the occurred events or zero if the file descriptor cannot be
+	///          waited on. Regular files are always ready.
+	static uint32_t
+	wait(int fd, uint32_t events);
+
+private:
+	uint32_t
+	suspend(int fd, uint32_t events);
+
+	/// Resumes the fibers whose file descriptors are ready.
+	/// @param timeout in milliseconds, -1 blocks indefinitely.
+	void
+	poll(int timeout);
+
+	uint32_t
+	eventsOf(int fd) const;
+
+	bool
+	update(int fd, uint32_t previous, uint32_t events);
+
+private:
+	int epfd{-1};
+	Waiter* waiters{nullptr};
+};
+
+} // namespace modm::fiber
+
+namespace modm::this_fiber
+{
+
+/// @ingroup modm_processing_fiber
+/// @{
+
+/**
+ * Suspends the current fiber until the file descriptor is readable.
+ * If no scheduler is running, this function blocks the thread instead.
+ *
+ * @returns `false` if the file descriptor cannot be waited on.
+ */
+bool
+wait_readable(int fd);
+
+/**
+ * Suspends the current fiber until the file descriptor is writable.
+ * If no scheduler is running, this function blocks the thread instead.
+ *
+ * @returns `false` if the file descriptor cannot be waited on.
+ */
+bool
+wait_writable(int fd);
+
+/// @}
+
+} // namespace modm::this_fiber
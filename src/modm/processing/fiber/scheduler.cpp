@@ -28,4 +28,70 @@ get_id()
 }
 
 } // namespace modm::this_fiber
+
+namespace modm::fiber
+{
+
+void
+suspend_for(modm::chrono::milli_clock::duration duration)
+{
+	Scheduler::instance().sleep<modm::chrono::milli_clock>(duration);
+}
+
+void
+suspend_for(modm::chrono::micro_clock::duration duration)
+{
+	Scheduler::instance().sleep<modm::chrono::micro_clock>(duration);
+}
+
+Task*
+WaitQueue::park()
+{
+	Task* task = Scheduler::instance().wait();
+	if (task == nullptr) return nullptr;
+	task->next = nullptr;
+	if (tail) tail->next = task;
+	else head = task;
+	tail = task;
+	return task;
+}
+
+void
+WaitQueue::suspend(Task& task)
+{
+	Scheduler::instance().dispatch(task);
+}
+
+bool
+WaitQueue::notify_one()
+{
+	Task* task;
+	{
+		const Guard guard(busy);
+		if ((task = head) == nullptr) return false;
+		if ((head = task->next) == nullptr) tail = nullptr;
+	}
+	Scheduler::notify(*task);
+	return true;
+}
+
+void
+WaitQueue::notify_all()
+{
+	Task* task;
+	{
+		const Guard guard(busy);
+		task = head;
+		head = tail = nullptr;
+	}
+	while (task)
+	{
+		// notifying overwrites the link to the next waiting fiber
+		Task* next = task->next;
+		Scheduler::notify(*task);
+		task = next;
+	}
+}
+
+} // namespace modm::fiber
 /// @endcond
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "functions.hpp"
+#include "wait_queue.hpp"
 #include <limits>
 #include <atomic>
 
@@ -32,6 +33,7 @@ class counting_semaphore
 	static_assert(LeastMaxValue <= uint16_t(-1), "counting_semaphore uses a 16-bit counter!");
 	using count_t = std::conditional_t<(LeastMaxValue < 256), uint8_t, uint16_t>;
 	std::atomic<count_t> count{};
+	WaitQueue waiters;
 
 public:
 	constexpr explicit
@@ -57,7 +59,8 @@ public:
 	void inline
 	acquire()
 	{
-		while(not try_acquire()) modm::this_fiber::yield();
+		while(not try_acquire())
+			waiters.wait([this]{ return count.load(std::memory_order_relaxed) != 0; });
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -65,6 +68,7 @@ public:
 	release()
 	{
 		count.fetch_add(1, std::memory_order_release);
+		waiters.notify_one();
 	}
 
 	template< typename Rep, typename Period >
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/interface/clock.hpp>
+#include <cstdint>
+
+namespace modm::fiber
+{
+
+/**
+ * Runtime statistics of a fiber measured with `modm::PreciseClock`.
+ *
+ * @ingroup modm_processing_fiber
+ */
+struct Statistics
+{
+	/// Total time the fiber was executing.
+	std::chrono::duration<uint64_t, std::micro> runtime{};
+	/// Number of times the scheduler switched to the fiber.
+	uint32_t switches{0};
+	/// Longest time the fiber executed without switching to another fiber.
+	modm::PreciseClock::duration max_slice{};
+	/// Longest time the fiber was ready but waited for other fibers.
+	modm::PreciseClock::duration max_wait{};
+
+	/// @cond
+	// Start of the current run-slice or the time the fiber became ready
+	modm::PreciseClock::time_point since{};
+	/// @endcond
+};
+
+} // namespace modm::fiber
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <atomic>
+#include <utility>
+
+namespace modm::fiber
+{
+
+// forward declaration
+class Task;
+
+/**
+ * Intrusive queue of fibers waiting on a synchronization primitive.
+ *
+ * Waiting fibers are removed from the ring of their scheduler, so that they do
+ * not consume any processing time, and are resumed in FIFO order when they are
+ * notified. Notifications can be sent from interrupts and other threads, since
+ * the notified fibers are only handed to their scheduler, which resumes them
+ * the next time it yields.
+ *
+ * The queue is protected by an atomic lock against interrupts and a spin lock
+ * against other threads or cores, which are only held for a few instructions.
+ *
+ * @ingroup modm_processing_fiber
+ */
+class WaitQueue
+{
+	WaitQueue(const WaitQueue&) = delete;
+	WaitQueue& operator=(const WaitQueue&) = delete;
+
+	class Guard
+	{
+		modm::atomic::Lock lock;
+		std::atomic_flag& busy;
+
+	public:
+		inline Guard(std::atomic_flag& busy) : busy(busy)
+		{
+			while (busy.test_and_set(std::memory_order_acquire)) ;
+		}
+		inline ~Guard() { busy.clear(std::memory_order_release); }
+	};
+
+	Task* head{nullptr};
+	Task* tail{nullptr};
+	std::atomic_flag busy{};
+
+	/// Removes the current fiber from its scheduler and appends it to the queue.
+	/// @returns `nullptr` if not called from a fiber.
+	Task*
+	park();
+
+	/// Switches to the next fiber until the parked fiber is notified.
+	static void
+	suspend(Task& task);
+
+public:
+	constexpr WaitQueue() = default;
+
+	/**
+	 * Suspends the current fiber until it is notified, unless `bool condition()`
+	 * returns true. The condition is evaluated while the queue is locked, so
+	 * that no notification is lost between checking the condition and waiting.
+	 * Outside of a fiber this function returns immediately.
+	 *
+	 * @warning The condition must not block or yield.
+	 */
+	template< class Condition >
+	void
+	wait(Condition&& condition)
+	{
+		Task* task;
+		{
+			const Guard guard(busy);
+			if (std::forward<Condition>(condition)()) return;
+			if ((task = park()) == nullptr) return;
+		}
+		suspend(*task);
+	}
+
+	/// Resumes the fiber that waits the longest.
+	/// @returns `true` if a fiber was waiting.
+	/// @note This function can be called from an interrupt.
+	bool
+	notify_one();
+
+	/// Resumes all waiting fibers.
+	/// @note This function can be called from an interrupt.
+	void
+	notify_all();
+};
+
+} // namespace modm::fiber
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "worker_pool.hpp"
+#include <algorithm>
+#include <vector>
+
+/// @cond
+namespace modm::fiber
+{
+
+void
+Scheduler::balance()
+{
+	pool->balance(*this);
+}
+
+void
+WorkerPool::balance(Scheduler& scheduler)
+{
+	std::lock_guard lock(mutex);
+	balances++;
+	// An idle scheduler has no fibers to hand over, but may pick one up
+	if (waiting > queue.size() and not scheduler.empty())
+	{
+		// The current fiber is running, only a waiting one can be handed over
+		if (Task* task = scheduler.removeNext())
+		{
+			queue.push_back(task);
+			available.notify_one();
+		}
+	}
+	else if (not queue.empty())
+	{
+		// All workers are busy, so help process the queue
+		scheduler.add(*queue.front());
+		queue.pop_front();
+	}
+	updateImbalance();
+}
+
+void
+WorkerPool::updateImbalance()
+{
+	const size_t queued = queue.size();
+	unsigned int state{0};
+	if (waiting > queued) state |= Scheduler::IdleWorkers;
+	if (waiting < queued) state |= Scheduler::QueuedFibers;
+	imbalance.store(state, std::memory_order_relaxed);
+}
+
+Task*
+WorkerPool::acquire()
+{
+	std::unique_lock lock(mutex);
+	waiting++;
+	updateImbalance();
+	while (true)
+	{
+		if (not queue.empty())
+		{
+			Task* task = queue.front();
+			queue.pop_front();
+			waiting--;
+			busy++;
+			updateImbalance();
+			return task;
+		}
+		// No fiber is running on any worker and none are queued anymore
+		if (done or busy == 0)
+		{
+			done = true;
+			waiting--;
+			updateImbalance();
+			available.notify_all();
+			return nullptr;
+		}
+		available.wait(lock);
+	}
+}
+
+void
+WorkerPool::release()
+{
+	std::lock_guard lock(mutex);
+	if (--busy == 0) available.notify_all();
+}
+
+void
+WorkerPool::work(Scheduler& scheduler)
+{
+	scheduler.pool = this;
+	scheduler.imbalance = &imbalance;
+	while (Task* task = acquire())
+	{
+		scheduler.add(*task);
+		// returns once all fibers on this worker have ended or were handed over
+		scheduler.start();
+		release();
+	}
+	scheduler.imbalance = nullptr;
+	scheduler.pool = nullptr;
+}
+
+void
+WorkerPool::run(unsigned int threads)
+{
+	Scheduler& main = Scheduler::instance();
+	{
+		std::lock_guard lock(mutex);
+		done = false;
+		// Move all fibers of the calling thread into the shared queue
+		while (not main.empty()) queue.push_back(main.removeFirst());
+		updateImbalance();
+	}
+
+	std::vector<std::thread> workers;
+	for (unsigned int ii = 1; ii < std::max(threads, 1u); ii++)
+		workers.emplace_back([this] { work(Scheduler::instance()); });
+	work(main);
+	for (auto& worker : workers) worker.join();
+}
+
+} // namespace modm::fiber
+/// @endcond
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "scheduler.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class WorkerPoolTest;
+
+namespace modm::fiber
+{
+
+/**
+ * Runs fibers on multiple threads of a hosted target.
+ *
+ * Each worker thread runs its own `modm::fiber::Scheduler`, whose ring of
+ * fibers is private to the worker, so that switching between fibers on the
+ * same worker is as cheap as in the single-threaded case. Idle workers request
+ * work from the pool and the busy workers hand over one of their waiting fibers
+ * the next time they yield. Thus fibers only ever migrate between threads while
+ * they are suspended. Fibers that are started before `run()` are queued and
+ * picked up by idle workers, or by busy workers once no worker is idle.
+ *
+ * The calling thread participates as the first worker and `run()` returns once
+ * all fibers have ended.
+ *
+ * @warning The fiber synchronization primitives that are implemented with
+ *          `<atomic>` can be used across workers. However, the primitives
+ *          relying on `modm::atomic::Lock` are not thread-safe on hosted
+ *          targets and must only be shared between fibers on the same worker.
+ *
+ * @ingroup modm_processing_fiber
+ */
+class WorkerPool
+{
+	friend class Scheduler;
+	friend class ::WorkerPoolTest;
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+public:
+	WorkerPool() = default;
+
+	/// Distributes all fibers of the calling thread's scheduler onto the
+	/// workers and runs them until all fibers have ended.
+	/// @param threads	The number of worker threads including the caller.
+	void
+	run(unsigned int threads = std::thread::hardware_concurrency());
+
+private:
+	void
+	work(Scheduler& scheduler);
+
+	Task*
+	acquire();
+
+	void
+	release();
+
+	void
+	balance(Scheduler& scheduler);
+
+	void
+	updateImbalance();
+
+private:
+	std::mutex mutex;
+	std::condition_variable available;
+	std::deque<Task*> queue;
+	unsigned int waiting{0};
+	unsigned int busy{0};
+	bool done{false};
+	std::atomic<unsigned int> imbalance{0};
+	/// Number of calls to `balance()`, which all take the lock
+	size_t balances{0};
+};
+
+} // namespace modm::fiber
@@ -17,6 +17,7 @@
 #define MODM_MONOCHROME_GRAPHIC_DISPLAY_HPP
 
 #include <stdlib.h>
+#include <type_traits>
 
 #include "graphic_display.hpp"
 
@@ -28,6 +29,10 @@ namespace modm
  * Every operation works on the internal RAM buffer, therefore the content
  * of the real display is not changed until a call of update().
  *
+ * The modified bytes of each buffer row are tracked as a range, so that
+ * drivers can transmit only the changed regions on update(). The whole
+ * buffer is dirty after construction and after clear().
+ *
  * \tparam	Width			Horizontal number of Pixels
  * \tparam	Height			Vertical number of Pixels
  * \tparam	BufferWidth		Horizontal (first) dimension of Buffer
@@ -75,8 +80,52 @@ public:
 	void
 	clear() final;
 
+	/// Marks the whole buffer as modified, so that it is transmitted completely
+	void
+	markDirty();
+
+	/// \return \c true if the buffer was modified since it was last transmitted
+	bool
+	isDirty() const;
+
 protected:
+	using DirtyIndex = std::conditional_t<(BufferWidth < 256), uint8_t, uint16_t>;
+
+	/// Range of modified bytes of a buffer row, empty if `first > last`
+	struct DirtyRange
+	{
+		DirtyIndex first{0};
+		DirtyIndex last{BufferWidth - 1};
+
+		bool
+		isEmpty() const
+		{ return first > last; }
+
+		std::size_t
+		getLength() const
+		{ return isEmpty() ? 0 : (last - first + 1); }
+	};
+
+	/// Marks the bytes `first` to `last` of the buffer rows `rowFirst` to
+	/// `rowLast` as modified. The ranges must be inside the buffer.
+	void
+	markDirty(std::size_t rowFirst, std::size_t rowLast, std::size_t first, std::size_t last);
+
+	/// \return \c true if all bytes of all buffer rows are modified
+	bool
+	isCompletelyDirty() const;
+
+	/// Marks the buffer row as transmitted
+	void
+	clearDirty(std::size_t row)
+	{ dirty[row] = DirtyRange{BufferWidth, 0}; }
+
+	/// Marks the whole buffer as transmitted
+	void
+	clearDirty();
+
 	uint8_t buffer[BufferHeight][BufferWidth]{};
+	DirtyRange dirty[BufferHeight]{};
 };
 }  // namespace modm
 
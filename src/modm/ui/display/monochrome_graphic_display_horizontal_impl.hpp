@@ -18,14 +18,22 @@ template<int16_t Width, int16_t Height>
 void
 MonochromeGraphicDisplayHorizontal<Width, Height>::setPixel(int16_t x, int16_t y)
 {
-	if ((x < Width) and (y < Height)) { this->buffer[y][x / 8] |= (1 << (x % 8)); }
+	if ((x >= 0) and (x < Width) and (y >= 0) and (y < Height))
+	{
+		this->buffer[y][x / 8] |= (1 << (x % 8));
+		this->markDirty(y, y, x / 8, x / 8);
+	}
 }
 
 template<int16_t Width, int16_t Height>
 void
 MonochromeGraphicDisplayHorizontal<Width, Height>::clearPixel(int16_t x, int16_t y)
 {
-	if ((x < Width) and (y < Height)) { this->buffer[y][x / 8] &= ~(1 << (x % 8)); }
+	if ((x >= 0) and (x < Width) and (y >= 0) and (y < Height))
+	{
+		this->buffer[y][x / 8] &= ~(1 << (x % 8));
+		this->markDirty(y, y, x / 8, x / 8);
+	}
 }
 
 template<int16_t Width, int16_t Height>
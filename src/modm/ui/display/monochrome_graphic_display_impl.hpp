@@ -24,4 +24,52 @@ modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::clear(
 {
 	std::fill(&buffer[0][0], &buffer[0][0] + sizeof(buffer), 0);
 	this->cursor = modm::glcd::Point{0, 0};
+	markDirty();
+}
+
+template<int16_t Width, int16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+void
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::markDirty()
+{
+	std::fill(std::begin(dirty), std::end(dirty), DirtyRange{});
+}
+
+template<int16_t Width, int16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+void
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::markDirty(
+	std::size_t rowFirst, std::size_t rowLast, std::size_t first, std::size_t last)
+{
+	for (std::size_t row = rowFirst; row <= rowLast; ++row)
+	{
+		DirtyRange& range = dirty[row];
+		if (range.isEmpty()) {
+			range = DirtyRange{DirtyIndex(first), DirtyIndex(last)};
+		} else {
+			range.first = std::min<DirtyIndex>(range.first, first);
+			range.last = std::max<DirtyIndex>(range.last, last);
+		}
+	}
+}
+
+template<int16_t Width, int16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+bool
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::isDirty() const
+{
+	return std::any_of(std::begin(dirty), std::end(dirty),
+					   [](const DirtyRange& range) { return not range.isEmpty(); });
+}
+
+template<int16_t Width, int16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+bool
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::isCompletelyDirty() const
+{
+	return std::all_of(std::begin(dirty), std::end(dirty),
+					   [](const DirtyRange& range) { return range.getLength() == BufferWidth; });
+}
+
+template<int16_t Width, int16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+void
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::clearDirty()
+{
+	std::fill(std::begin(dirty), std::end(dirty), DirtyRange{BufferWidth, 0});
 }
\ No newline at end of file
@@ -28,8 +28,12 @@ modm::MonochromeGraphicDisplayVertical<Width, Height>::drawHorizontalLine(glcd::
 		const uint8_t byte = 1 << (start.y % 8);
 		for (int_fast16_t x = start.x; x < static_cast<int16_t>(start.x + length); ++x)
 		{
-			if (x < Width) { this->buffer[y][x] |= byte; }
+			if (x >= 0 and x < Width) { this->buffer[y][x] |= byte; }
 		}
+
+		const int16_t first = std::max<int16_t>(start.x, 0);
+		const int16_t last = std::min<int16_t>(start.x + length - 1, Width - 1);
+		if (first <= last) { this->markDirty(y, y, first, last); }
 	}
 }
 
@@ -61,6 +65,10 @@ modm::MonochromeGraphicDisplayVertical<Width, Height>::drawVerticalLine(glcd::Po
 			byte &= 0xFF >> (8 - end_y % 8);
 			this->buffer[y][start.x] |= byte;
 		}
+
+		const uint_fast8_t first = std::max<int16_t>(start.y, 0) / 8;
+		const uint_fast8_t last = std::min<uint_fast8_t>(y, Height / 8 - 1);
+		if (first <= last) { this->markDirty(first, last, start.x, start.x); }
 	}
 }
 
@@ -89,6 +97,13 @@ modm::MonochromeGraphicDisplayVertical<Width, Height>::drawImageRaw(
 					}
 				}
 			}
+			const int16_t first = std::max<int16_t>(start.x, 0);
+			const int16_t last = std::min<int16_t>(start.x + width, Width) - 1;
+			if (first <= last and row < Height / 8)
+			{
+				this->markDirty(row, std::min<int16_t>(row + rowCount, Height / 8) - 1,
+								first, last);
+			}
 			return;
 		}
 	}
@@ -100,14 +115,22 @@ template<int16_t Width, int16_t Height>
 void
 modm::MonochromeGraphicDisplayVertical<Width, Height>::setPixel(int16_t x, int16_t y)
 {
-	if (x < Width and y < Height) { this->buffer[y / 8][x] |= (1 << y % 8); }
+	if (x >= 0 and x < Width and y >= 0 and y < Height)
+	{
+		this->buffer[y / 8][x] |= (1 << y % 8);
+		this->markDirty(y / 8, y / 8, x, x);
+	}
 }
 
 template<int16_t Width, int16_t Height>
 void
 modm::MonochromeGraphicDisplayVertical<Width, Height>::clearPixel(int16_t x, int16_t y)
 {
-	if (x < Width and y < Height) { this->buffer[y / 8][x] &= ~(1 << y % 8); }
+	if (x >= 0 and x < Width and y >= 0 and y < Height)
+	{
+		this->buffer[y / 8][x] &= ~(1 << y % 8);
+		this->markDirty(y / 8, y / 8, x, x);
+	}
 }
 
 template<int16_t Width, int16_t Height>
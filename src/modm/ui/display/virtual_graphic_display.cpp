@@ -16,7 +16,8 @@ modm::VirtualGraphicDisplay::VirtualGraphicDisplay(modm::ColorGraphicDisplay* di
 		modm::glcd::Point leftUpper, modm::glcd::Point rightLower):
 		display(display), leftUpper(leftUpper), rightLower(rightLower),
 		width(static_cast<uint16_t>(this->rightLower[0] - this->leftUpper[0])),
-		height(static_cast<uint16_t>(this->rightLower[1] - this->leftUpper[1]))
+		height(static_cast<uint16_t>(this->rightLower[1] - this->leftUpper[1])),
+		dirty(true)
 {
 }
 
@@ -24,6 +25,7 @@ void
 modm::VirtualGraphicDisplay::setDisplay(modm::ColorGraphicDisplay* display)
 {
 	this->display = display;
+	this->dirty = true;
 	return;
 }
 
@@ -34,12 +36,17 @@ modm::VirtualGraphicDisplay::clear()
 	this->display->setColor(color::Rgb(0, 0, 0));
 	this->display->fillRectangle(this->leftUpper, width, height);
 	this->display->setColor(color::Rgb(255, 255, 255));
+	this->dirty = true;
 }
 
 void
 modm::VirtualGraphicDisplay::update()
 {
-	this->display->update();
+	if (this->dirty)
+	{
+		this->display->update();
+		this->dirty = false;
+	}
 	return;
 }
 
@@ -47,12 +54,14 @@ void
 modm::VirtualGraphicDisplay::setPixel(int16_t x, int16_t y)
 {
 	this->display->setPixel(x + this->leftUpper[0], y + this->leftUpper[1]);
+	this->dirty = true;
 }
 
 void
 modm::VirtualGraphicDisplay::clearPixel(int16_t x, int16_t y)
 {
 	this->display->clearPixel(x + this->leftUpper[0], y + this->leftUpper[1] );
+	this->dirty = true;
 }
 
 modm::color::Rgb565
@@ -20,7 +20,14 @@
 
 namespace modm
 {
-/// @ingroup modm_ui_display
+/**
+ * Draws into a rectangular area of another display.
+ *
+ * update() only updates the underlying display if pixels were drawn since
+ * the last update.
+ *
+ * @ingroup modm_ui_display
+ */
 class VirtualGraphicDisplay : public modm::ColorGraphicDisplay
 {
 public:
@@ -48,6 +55,13 @@ public:
 	virtual void
 	update();
 
+	/// @return `true` if pixels were drawn since the last update()
+	inline bool
+	isDirty() const
+	{
+		return this->dirty;
+	}
+
 protected:
 	void
 	setPixel(int16_t x, int16_t y) final;
@@ -64,6 +78,7 @@ private:
 	modm::glcd::Point rightLower;
 	const uint16_t width;
 	const uint16_t height;
+	bool dirty;
 };
 
 }  // namespace modm
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "benchmark.hpp"
+
+#include <modm/architecture/detect.hpp>
+
+#if MODM_OS_HOSTED
+#	include <chrono>
+#	if MODM_CPU_AMD64 || MODM_CPU_I386
+#		include <x86intrin.h>
+#	endif
+#elif MODM_CPU_CORTEX_M && !MODM_CPU_CORTEX_M0
+// The DWT cycle counter is enabled by modm:platform:cortex-m on startup
+#	include <modm/platform/device.hpp>
+extern "C" uint32_t SystemCoreClock;
+#	define UNITTEST_BENCHMARK_DWT 1
+#endif
+
+// ----------------------------------------------------------------------------
+bool
+unittest::Benchmark::hasTimer()
+{
+#if MODM_OS_HOSTED || UNITTEST_BENCHMARK_DWT
+	return true;
+#else
+	return false;
+#endif
+}
+
+uint64_t
+unittest::Benchmark::nanoseconds()
+{
+#if MODM_OS_HOSTED
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#elif UNITTEST_BENCHMARK_DWT
+	const uint64_t now = cycles();
+	return (now / SystemCoreClock) * 1'000'000'000ull +
+		   ((now % SystemCoreClock) * 1'000'000'000ull) / SystemCoreClock;
+#else
+	return 0;
+#endif
+}
+
+uint64_t
+unittest::Benchmark::cycles()
+{
+#if MODM_OS_HOSTED && (MODM_CPU_AMD64 || MODM_CPU_I386)
+	return __rdtsc();
+#elif UNITTEST_BENCHMARK_DWT
+	// The 32-bit counter wraps within seconds, so extend it while sampling
+	static uint32_t last{0};
+	static uint64_t total{0};
+	const uint32_t now = DWT->CYCCNT;
+	total += uint32_t(now - last);
+	last = now;
+	return total;
+#else
+	return 0;
+#endif
+}
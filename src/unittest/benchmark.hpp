@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	UNITTEST_BENCHMARK_HPP
+#define	UNITTEST_BENCHMARK_HPP
+
+#include <stdint.h>
+#include <algorithm>
+
+#include "harness.hpp"
+
+/// Minimum duration of one benchmark sample in microseconds
+#ifndef	UNITTEST_BENCHMARK_TIME_US
+#	define	UNITTEST_BENCHMARK_TIME_US	10'000
+#endif
+
+/// Number of samples of which the fastest is reported
+#ifndef	UNITTEST_BENCHMARK_SAMPLES
+#	define	UNITTEST_BENCHMARK_SAMPLES	3
+#endif
+
+namespace unittest
+{
+	/// Forces the compiler to compute `value`, even if it is unused.
+	/// \ingroup	modm_unittest
+	template< typename T >
+	inline void
+	doNotOptimize(const T& value)
+	{
+		asm volatile ("" : : "r,m" (value) : "memory");
+	}
+
+	/// Forces the compiler to perform all pending writes to memory.
+	/// \ingroup	modm_unittest
+	inline void
+	clobberMemory()
+	{
+		asm volatile ("" : : : "memory");
+	}
+
+	/**
+	 * \brief	Microbenchmark
+	 *
+	 * Calls a function in a loop and measures the time and the number of
+	 * CPU cycles per batch of iterations. After a warm-up call, the number
+	 * of iterations is scaled up until one batch takes at least the
+	 * minimum time, then the fastest of several batches is reported.
+	 *
+	 * The time is measured independently of `modm::PreciseClock`, which
+	 * is mocked in unit tests:
+	 *
+	 * - Hosted: `std::chrono::steady_clock` and the time stamp counter on x86.
+	 * - ARMv7-M and above: the `DWT->CYCCNT` cycle counter.
+	 * - Otherwise a fixed number of iterations is run without timing.
+	 *
+	 * The result is written by the reporter as one JSON object per line.
+	 *
+	 * \code
+	 * void
+	 * ContainerBenchmark::benchmarkDeque()
+	 * {
+	 *     modm::BoundedDeque<int, 64> deque;
+	 *     unittest::benchmark("BoundedDeque::append", [&]
+	 *     {
+	 *         if (not deque.append(1)) deque.clear();
+	 *     });
+	 * }
+	 * \endcode
+	 *
+	 * \ingroup	modm_unittest
+	 */
+	class Benchmark
+	{
+	public:
+		struct Result
+		{
+			uint32_t iterations;
+			uint64_t nanoseconds;	///< for all iterations, 0 if unknown
+			uint64_t cycles;		///< for all iterations, 0 if unknown
+		};
+
+		/// \c true if the target can measure time
+		static bool
+		hasTimer();
+
+		/// Monotonic time in nanoseconds, 0 if unknown
+		static uint64_t
+		nanoseconds();
+
+		/// Monotonic CPU cycle count, 0 if unknown
+		static uint64_t
+		cycles();
+
+	public:
+		Benchmark(uint32_t minimumTime_us = UNITTEST_BENCHMARK_TIME_US,
+				  uint8_t samples = UNITTEST_BENCHMARK_SAMPLES) :
+			minimumTime(uint64_t(minimumTime_us) * 1000), samples(samples)
+		{
+		}
+
+		/// Measures `function()` and reports the fastest sample.
+		template< typename Function >
+		Result
+		run(const char* name, Function&& function);
+
+	private:
+		template< typename Function >
+		static Result
+		measure(Function& function, uint32_t iterations);
+
+		static constexpr uint32_t FallbackIterations = 100;
+		static constexpr uint32_t MaximumIterations = 1ul << 30;
+
+		uint64_t minimumTime;
+		uint8_t samples;
+	};
+
+	/// Runs a benchmark with the default settings.
+	/// \ingroup	modm_unittest
+	template< typename Function >
+	inline Benchmark::Result
+	benchmark(const char* name, Function&& function)
+	{
+		return Benchmark().run(name, function);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template< typename Function >
+unittest::Benchmark::Result
+unittest::Benchmark::measure(Function& function, uint32_t iterations)
+{
+	const uint64_t startCycles = cycles();
+	const uint64_t startTime = nanoseconds();
+	for (uint32_t ii = 0; ii < iterations; ++ii) {
+		function();
+		clobberMemory();
+	}
+	const uint64_t stopTime = nanoseconds();
+	const uint64_t stopCycles = cycles();
+
+	return {iterations, stopTime - startTime, stopCycles - startCycles};
+}
+
+template< typename Function >
+unittest::Benchmark::Result
+unittest::Benchmark::run(const char* name, Function&& function)
+{
+	// warm up caches, branch predictors and lazy initialization
+	Result result = measure(function, 1);
+
+	if (hasTimer())
+	{
+		uint32_t iterations = 1;
+		while (result.nanoseconds < minimumTime and iterations < MaximumIterations)
+		{
+			// aim 20% above the minimum time, but grow at most 10x per step
+			uint64_t target = iterations * 10ull;
+			if (result.nanoseconds * 10 > minimumTime)
+			{
+				// scale in 8-bit fixed point to avoid overflows
+				const uint64_t scale = (minimumTime * 6 * 256) / (result.nanoseconds * 5);
+				target = std::max<uint64_t>(iterations + 1ull, (iterations * scale) / 256);
+			}
+			iterations = std::min<uint64_t>(target, MaximumIterations);
+			result = measure(function, iterations);
+		}
+		for (uint8_t ii = 1; ii < samples; ++ii)
+		{
+			const Result sample = measure(function, iterations);
+			if (sample.nanoseconds < result.nanoseconds) {
+				result = sample;
+			}
+		}
+	}
+	else {
+		result = measure(function, FallbackIterations);
+	}
+
+	TEST_REPORTER_.reportBenchmark(name, result.iterations,
+								   result.nanoseconds, result.cycles);
+	return result;
+}
+
+#endif	// UNITTEST_BENCHMARK_HPP
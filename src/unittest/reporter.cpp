@@ -24,6 +24,12 @@ namespace
 	FLASH_STORAGE_STRING(failHeader) = "FAIL: ";
 	FLASH_STORAGE_STRING(failColon) = " : ";
 
+	FLASH_STORAGE_STRING(benchmarkSuite) = "{\"suite\": \"";
+	FLASH_STORAGE_STRING(benchmarkName) = "\", \"benchmark\": \"";
+	FLASH_STORAGE_STRING(benchmarkIterations) = "\", \"iterations\": ";
+	FLASH_STORAGE_STRING(benchmarkTime) = ", \"ns\": ";
+	FLASH_STORAGE_STRING(benchmarkCycles) = ", \"cycles\": ";
+
 	FLASH_STORAGE_STRING(reportPassed) = "\nPassed ";
 	FLASH_STORAGE_STRING(reportFailed) = "\nFailed ";
 	FLASH_STORAGE_STRING(reportOf) = " of ";
@@ -75,6 +81,23 @@ unittest::Reporter::reportFailure(unsigned int lineNumber)
 	return outputStream;
 }
 
+void
+unittest::Reporter::reportBenchmark(const char* name, uint32_t iterations,
+									uint64_t nanoseconds, uint64_t cycles)
+{
+	outputStream << modm::accessor::asFlash(benchmarkSuite)
+				 << testName
+				 << modm::accessor::asFlash(benchmarkName)
+				 << name
+				 << modm::accessor::asFlash(benchmarkIterations)
+				 << iterations
+				 << modm::accessor::asFlash(benchmarkTime)
+				 << nanoseconds
+				 << modm::accessor::asFlash(benchmarkCycles)
+				 << cycles
+				 << '}' << modm::endl;
+}
+
 uint8_t
 unittest::Reporter::printSummary()
 {
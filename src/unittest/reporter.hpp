@@ -75,6 +75,16 @@ namespace unittest
 		modm::IOStream&
 		reportFailure(unsigned int lineNumber);
 
+		/**
+		 * \brief	Report the result of a benchmark
+		 *
+		 * Writes one JSON object per line, so that the results can be
+		 * extracted from the output and compared between builds.
+		 */
+		void
+		reportBenchmark(const char* name, uint32_t iterations,
+						uint64_t nanoseconds, uint64_t cycles);
+
 		/**
 		 * \brief	Writes a summary of all the tests
 		 *
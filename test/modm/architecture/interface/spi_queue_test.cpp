@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "spi_queue_test.hpp"
+
+#include <modm/architecture/interface/spi_queue.hpp>
+#include <modm-test/mock/spi_master.hpp>
+
+using SpiMaster = modm_test::platform::SpiMaster;
+
+// ----------------------------------------------------------------------------
+static uint8_t selects;
+static uint8_t deselects;
+static uint8_t configurationsA;
+static uint8_t configurationsB;
+
+static void
+chipSelect(bool select)
+{
+	if (select) selects++;
+	else deselects++;
+}
+
+static void configureA() { configurationsA++; }
+static void configureB() { configurationsB++; }
+
+void
+SpiQueueTest::setUp()
+{
+	SpiMaster::clearBuffers();
+	selects = deselects = 0;
+	configurationsA = configurationsB = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+SpiQueueTest::testBackToBack()
+{
+	modm::SpiQueue<SpiMaster> queue;
+	TEST_ASSERT_TRUE(queue.isEmpty());
+
+	const uint8_t tx1[] = {0x01, 0x02};
+	const uint8_t tx2[] = {0x03};
+	uint8_t rx2[1] = {};
+	uint8_t rx3[3] = {};
+
+	modm::SpiTransaction first(tx1, nullptr, sizeof(tx1), chipSelect);
+	modm::SpiTransaction second(tx2, rx2, sizeof(tx2), chipSelect);
+	modm::SpiTransaction third(nullptr, rx3, sizeof(rx3));
+
+	uint8_t response[] = {0xa0, 0xa1, 0xb0, 0xc0, 0xc1, 0xc2};
+	SpiMaster::appendRxBuffer(response, sizeof(response));
+
+	TEST_ASSERT_TRUE(queue.submit(first));
+	TEST_ASSERT_TRUE(queue.submit(second));
+	TEST_ASSERT_TRUE(queue.submit(third));
+	TEST_ASSERT_FALSE(queue.isEmpty());
+	TEST_ASSERT_TRUE(first.isBusy());
+
+	RF_CALL_BLOCKING(queue.execute());
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_FALSE(first.isBusy());
+	TEST_ASSERT_FALSE(second.isBusy());
+	TEST_ASSERT_FALSE(third.isBusy());
+	TEST_ASSERT_EQUALS(selects, 2);
+	TEST_ASSERT_EQUALS(deselects, 2);
+
+	// transferred in the order of submission
+	const uint8_t expected[] = {0x01, 0x02, 0x03, 0x00, 0x00, 0x00};
+	uint8_t sent[sizeof(expected)];
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), sizeof(expected));
+	SpiMaster::popTxBuffer(sent);
+	TEST_ASSERT_EQUALS_ARRAY(sent, expected, sizeof(expected));
+
+	TEST_ASSERT_EQUALS(rx2[0], 0xb0);
+	TEST_ASSERT_EQUALS_ARRAY(rx3, &response[3], 3);
+
+	// the master was released
+	TEST_ASSERT_EQUALS(SpiMaster::acquire(this), 1);
+	TEST_ASSERT_EQUALS(SpiMaster::release(this), 0);
+}
+
+void
+SpiQueueTest::testSubmitBusy()
+{
+	modm::SpiQueue<SpiMaster> queue;
+	const uint8_t tx[] = {0x42};
+	modm::SpiTransaction transaction(tx, nullptr, sizeof(tx));
+
+	TEST_ASSERT_TRUE(queue.submit(transaction));
+	// a busy transaction cannot be queued twice
+	TEST_ASSERT_FALSE(queue.submit(transaction));
+
+	RF_CALL_BLOCKING(queue.execute());
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 1u);
+
+	// but again after it is finished
+	TEST_ASSERT_TRUE(queue.submit(transaction));
+	RF_CALL_BLOCKING(queue.execute());
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 2u);
+}
+
+void
+SpiQueueTest::testConfiguration()
+{
+	modm::SpiQueue<SpiMaster> queue;
+	const uint8_t tx[] = {0x42};
+	modm::SpiTransaction transactions[] = {
+		{tx, nullptr, sizeof(tx), nullptr, configureA},
+		{tx, nullptr, sizeof(tx), nullptr, nullptr},
+		{tx, nullptr, sizeof(tx), nullptr, configureA},
+		{tx, nullptr, sizeof(tx), nullptr, configureB},
+		{tx, nullptr, sizeof(tx), nullptr, configureA},
+	};
+	for (auto &transaction : transactions) {
+		TEST_ASSERT_TRUE(queue.submit(transaction));
+	}
+
+	RF_CALL_BLOCKING(queue.execute());
+
+	// the master is only reconfigured when the configuration changes
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 5u);
+	TEST_ASSERT_EQUALS(configurationsA, 2);
+	TEST_ASSERT_EQUALS(configurationsB, 1);
+}
@@ -320,3 +320,109 @@ AmnbNodeTest::testListener()
 		TEST_ASSERT_EQUALS(count, 11+21+12+22);
 	}
 }
+
+static uint16_t dispatched{0};
+
+/// Dispatches messages to lists that contain the same handlers in any order
+template< size_t IndexSize >
+static void
+checkDispatch(Action (&actions)[5], Listener (&listeners)[5])
+{
+	DeviceWrapper<SharedMedium> dev;
+	Node<2, 0, IndexSize> node(dev, 0x08, actions, listeners);
+
+	dispatched = 0;
+	SharedMedium::reset();
+	SharedMedium::add_rx({0x7E, 0x7E, 163, 8, 10, 64});
+	{
+		node.update(); node.update();
+		TEST_ASSERT_EQUALS(dispatched, 10);
+	}
+	// System Error: No action!
+	dispatched = 0;
+	SharedMedium::reset();
+	SharedMedium::add_rx({0x7E, 0x7E, 233, 8, 4, 64});
+	{
+		node.update(); node.update();
+		TEST_ASSERT_EQUALS(dispatched, 0);
+		const uint8_t raw[] = {0x7E, 0x7E, 181, 8, 4, 129, 3};
+		TEST_ASSERT_EQUALS(SharedMedium::transmitted.size(), sizeof(raw));
+		TEST_ASSERT_EQUALS_ARRAY(SharedMedium::transmitted, raw, sizeof(raw));
+	}
+	// listeners on the same command are called in the order of the list
+	dispatched = 0;
+	SharedMedium::reset();
+	SharedMedium::add_rx({0x7E, 0x7E, 90, 32, 5, 0});
+	{
+		node.update();
+		TEST_ASSERT_EQUALS(dispatched, 135);
+	}
+}
+
+void
+AmnbNodeTest::testDispatch()
+{
+	// sorted by command with gaps
+	Action sortedActions[] =
+	{
+		{1, []() { dispatched = 1; }},
+		{3, []() { dispatched = 3; }},
+		{7, []() { dispatched = 7; }},
+		{8, []() { dispatched = 8; }},
+		{10, []() { dispatched = 10; }},
+	};
+	Listener sortedListeners[] =
+	{
+		{1, [](uint8_t) { dispatched = dispatched * 10 + 4; }},
+		{2, [](uint8_t) { dispatched = dispatched * 10 + 2; }},
+		{5, [](uint8_t) { dispatched = dispatched * 10 + 1; }},
+		{5, [](uint8_t) { dispatched = dispatched * 10 + 3; }},
+		{5, [](uint8_t) { dispatched = dispatched * 10 + 5; }},
+	};
+	Action unsortedActions[] =
+	{
+		{10, []() { dispatched = 10; }},
+		{3, []() { dispatched = 3; }},
+		{8, []() { dispatched = 8; }},
+		{1, []() { dispatched = 1; }},
+		{7, []() { dispatched = 7; }},
+	};
+	Listener unsortedListeners[] =
+	{
+		{5, [](uint8_t) { dispatched = dispatched * 10 + 1; }},
+		{2, [](uint8_t) { dispatched = dispatched * 10 + 2; }},
+		{5, [](uint8_t) { dispatched = dispatched * 10 + 3; }},
+		{1, [](uint8_t) { dispatched = dispatched * 10 + 4; }},
+		{5, [](uint8_t) { dispatched = dispatched * 10 + 5; }},
+	};
+	// linear search
+	checkDispatch<0>(sortedActions, sortedListeners);
+	checkDispatch<0>(unsortedActions, unsortedListeners);
+	// binary search through the index
+	checkDispatch<5>(sortedActions, sortedListeners);
+	checkDispatch<5>(unsortedActions, unsortedListeners);
+}
+
+void
+AmnbNodeTest::testBatching()
+{
+	static uint8_t trig{0};
+	// unsorted
+	Listener listeners[] =
+	{
+		{2, [](uint8_t) { trig |= 2; }},
+		{1, [](uint8_t) { trig |= 1; }},
+	};
+	DeviceWrapper<SharedMedium> dev;
+	Node node(dev, 8, listeners);
+	node.setBatching(true);
+
+	trig = 0;
+	SharedMedium::reset();
+	SharedMedium::add_rx({0x7E, 0x7E, 4, 32, 1, 0});
+	SharedMedium::add_rx({0x7E, 0x7E, 255, 32, 2, 0});
+	{
+		node.update();
+		TEST_ASSERT_EQUALS(trig, 3);
+	}
+}
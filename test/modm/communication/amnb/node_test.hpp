@@ -21,4 +21,6 @@ public:
 	void testRequest();
 	void testAction();
 	void testListener();
+	void testDispatch();
+	void testBatching();
 };
@@ -159,6 +159,21 @@ CanConnectorTest::testSendFragmentedMessage()
 	TEST_ASSERT_EQUALS(connector->messageCounter, 0x40);
 }
 
+void
+CanConnectorTest::testSendOversizeMessage()
+{
+	driver->sendSlots = 20;
+
+	// the fragment index cannot address more than 16 fragments
+	modm::SmartPointer payload(uint16_t(xpcc::CanConnectorBase::maxFragmentedSize + 1));
+	connector->sendPacket(xpccHeader, payload);
+
+	for (uint8_t ii = 0; ii < 20; ++ii) {
+		connector->update();
+	}
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
+}
+
 void
 CanConnectorTest::testReceiveShortMessage()
 {
@@ -257,3 +272,127 @@ CanConnectorTest::testReceiveFragmentedMessage()
 
 	TEST_ASSERT_FALSE(connector->isPacketAvailable());
 }
+
+void
+CanConnectorTest::testSendInterleavedMessages()
+{
+	static_assert(TestingCanConnector::sendWindow >= 2,
+			"Interleaving requires a test configuration with can.window >= 2!");
+	this->messageCounter = connector->messageCounter = 0x30;
+
+	modm::SmartPointer payload(&fragmentedPayload);
+	connector->sendPacket(xpccHeader, payload);
+	connector->sendPacket(xpccHeader, payload);
+
+	// one fragment of each packet per update
+	driver->sendSlots = 10;
+	connector->update();
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 2U);
+
+	checkFragmentedMessage(driver->sendList.getFront(), 0);
+	driver->sendList.removeFront();
+
+	// the second packet uses the next message counter
+	this->messageCounter = 0x40;
+	checkFragmentedMessage(driver->sendList.getFront(), 0);
+	driver->sendList.removeFront();
+
+	connector->update();
+	connector->update();
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 4U);
+
+	for (uint8_t fragment = 1; fragment < 3; ++fragment)
+	{
+		this->messageCounter = 0x30;
+		checkFragmentedMessage(driver->sendList.getFront(), fragment);
+		driver->sendList.removeFront();
+
+		this->messageCounter = 0x40;
+		checkFragmentedMessage(driver->sendList.getFront(), fragment);
+		driver->sendList.removeFront();
+	}
+
+	connector->update();
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
+	TEST_ASSERT_EQUALS(connector->messageCounter, 0x50);
+}
+
+void
+CanConnectorTest::testReceiveInterleavedMessages()
+{
+	modm::can::Message message;
+
+	// fragments of two packets with different sources and counters
+	for (uint8_t fragment = 0; fragment < 3; ++fragment)
+	{
+		this->messageCounter = 0x20;
+		createMessage(message, fragment);
+		driver->receiveList.append(message);
+
+		this->messageCounter = 0x70;
+		createMessage(message, fragment);
+		message.identifier = fragmentedIdentifier ^ 0x00000100;
+		driver->receiveList.append(message);
+	}
+
+	connector->update();
+
+	TEST_ASSERT_TRUE(connector->isPacketAvailable());
+	TEST_ASSERT_EQUALS(connector->getPacketHeader(), xpccHeader);
+	TEST_ASSERT_EQUALS(connector->getPacketPayload().getSize(), sizeof(fragmentedPayload));
+	TEST_ASSERT_EQUALS_ARRAY(
+			connector->getPacketPayload().getPointer(),
+			fragmentedPayload,
+			sizeof(fragmentedPayload));
+	connector->dropPacket();
+
+	TEST_ASSERT_TRUE(connector->isPacketAvailable());
+	TEST_ASSERT_EQUALS(connector->getPacketHeader().source, xpccHeader.source ^ 0x01);
+	TEST_ASSERT_EQUALS_ARRAY(
+			connector->getPacketPayload().getPointer(),
+			fragmentedPayload,
+			sizeof(fragmentedPayload));
+	connector->dropPacket();
+
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+}
+
+void
+CanConnectorTest::testReceiveEvictsOldestMessage()
+{
+	modm::can::Message message;
+
+	// start more incomplete packets than there are reassembly slots
+	static_assert(TestingCanConnector::reassemblySlots <= 0x0f,
+			"The 4-bit message counter cannot fill more than 15 reassembly slots!");
+	const uint8_t newest = TestingCanConnector::reassemblySlots;
+	for (uint8_t counter = 0; counter <= newest; ++counter)
+	{
+		this->messageCounter = counter << 4;
+		createMessage(message, 0);
+		driver->receiveList.append(message);
+	}
+	connector->update();
+
+	// the oldest packet was dropped and cannot be completed anymore
+	this->messageCounter = 0x00;
+	createMessage(message, 1);
+	driver->receiveList.append(message);
+	createMessage(message, 2);
+	driver->receiveList.append(message);
+	connector->update();
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+
+	// the newest packet is still reassembled
+	this->messageCounter = newest << 4;
+	createMessage(message, 1);
+	driver->receiveList.append(message);
+	createMessage(message, 2);
+	driver->receiveList.append(message);
+	connector->update();
+	TEST_ASSERT_TRUE(connector->isPacketAvailable());
+	TEST_ASSERT_EQUALS_ARRAY(
+			connector->getPacketPayload().getPointer(),
+			fragmentedPayload,
+			sizeof(fragmentedPayload));
+}
@@ -53,12 +53,24 @@ public:
     void
     testSendFragmentedMessage();
 
+    void
+    testSendOversizeMessage();
+
     void
     testReceiveShortMessage();
 
     void
     testReceiveFragmentedMessage();
 
+    void
+    testSendInterleavedMessages();
+
+    void
+    testReceiveInterleavedMessages();
+
+    void
+    testReceiveEvictsOldestMessage();
+
 private:
 	TestingCanConnector *connector;
 	modm_test::platform::CanDriver *driver;
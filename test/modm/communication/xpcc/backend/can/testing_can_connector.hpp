@@ -27,6 +27,8 @@ public:
 
 	// expose the internal variable for testing
 	using xpcc::CanConnector<modm_test::platform::CanDriver>::messageCounter;
+	using xpcc::CanConnector<modm_test::platform::CanDriver>::reassemblySlots;
+	using xpcc::CanConnector<modm_test::platform::CanDriver>::sendWindow;
 };
 
 #endif	// TESTING_CAN_CONNECTOR_HPP
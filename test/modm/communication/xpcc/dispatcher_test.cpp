@@ -528,3 +528,65 @@ DispatcherTest::testResponseRetransmission()
 
 	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 0U);
 }
+
+// ----------------------------------------------------------------------------
+void
+DispatcherTest::testResponseTimeout()
+{
+	xpcc::ResponseCallback callback(component2, &TestingComponent2::responseNoParameter);
+	TEST_ASSERT_TRUE(component2->callAction(1, 0x13, callback));
+
+	dispatcher->update();
+
+	TEST_ASSERT_EQUALS(timeline->events.getSize(), 1U);
+	TEST_ASSERT_TRUE(timeline->events.getFront().type == Timeline::Type::Action);
+	timeline->events.removeFront();
+
+	test_clock::increment(xpcc::Dispatcher::responseTimeout.count() - 1);
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(timeline->events.getSize(), 0U);
+
+	// the callback is called with a timeout
+	test_clock::increment(2);
+	dispatcher->update();
+
+	TEST_ASSERT_EQUALS(timeline->events.getSize(), 1U);
+	TEST_ASSERT_TRUE(timeline->events.getFront().type == Timeline::Type::Response);
+	TEST_ASSERT_EQUALS(timeline->events.getFront().id, 0x30);
+	TEST_ASSERT_EQUALS(timeline->events.getFront().component, 2);
+	timeline->events.removeFront();
+
+	// a late response does not call the callback again
+	component1->update();
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(timeline->events.getSize(), 0U);
+}
+
+void
+DispatcherTest::testEntryPoolExhaustion()
+{
+	// fill the pool, the surplus action call is dropped
+	for (std::size_t i = 0; i < xpcc::Dispatcher::maxEntries; i++) {
+		TEST_ASSERT_TRUE(component1->callAction(10, i));
+	}
+	TEST_ASSERT_FALSE(component1->callAction(10, xpcc::Dispatcher::maxEntries));
+
+	dispatcher->update();
+
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), xpcc::Dispatcher::maxEntries);
+	backend->messagesSend.removeAll();
+
+	// acknowledging the first request releases its entry
+	backend->messagesToReceive.append(
+			Message(xpcc::Header(xpcc::Header::Type::REQUEST, true, 1, 10, 0),
+					modm::SmartPointer()));
+
+	dispatcher->update();
+
+	component1->callAction(10, 0xf3);
+	dispatcher->update();
+
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 1U);
+	TEST_ASSERT_EQUALS(backend->messagesSend.getFront().header,
+			xpcc::Header(xpcc::Header::Type::REQUEST, false, 10, 1, 0xf3));
+}
@@ -112,6 +112,17 @@ public:
 	void
 	testResponseRetransmission();
 
+	// A missing response times out and releases the entry
+	void
+	testResponseTimeout();
+
+	/*
+	 * Step 5:
+	 * Check the fixed capacity of the entry pool
+	 */
+	void
+	testEntryPoolExhaustion();
+
 private:
 	xpcc::Dispatcher *dispatcher;
 	FakeBackend *backend;
@@ -14,6 +14,7 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/container/deque.hpp>
+#include <unittest/benchmark.hpp>
 
 #include "bounded_deque_test.hpp"
 
@@ -368,3 +369,21 @@ BoundedDequeTest::testElementAccess()
 	TEST_ASSERT_EQUALS(deque.rget(2), 2);
 
 }
+
+void
+BoundedDequeTest::benchmarkAppendRemove()
+{
+	modm::BoundedDeque<int16_t, 64> deque;
+	while (deque.getSize() < 32) {
+		deque.append(0);
+	}
+
+	int16_t value = 0;
+	unittest::benchmark("BoundedDeque::append+removeFront", [&]
+	{
+		deque.append(value++);
+		unittest::doNotOptimize(deque.getFront());
+		deque.removeFront();
+	});
+	TEST_ASSERT_EQUALS(deque.getSize(), 32U);
+}
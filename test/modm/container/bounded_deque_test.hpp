@@ -46,4 +46,7 @@ public:
 
 	void
 	testElementAccess();
+
+	void
+	benchmarkAppendRemove();
 };
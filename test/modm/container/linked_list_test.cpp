@@ -15,6 +15,7 @@
 
 #include <unittest/type/count_type.hpp>
 #include <modm/container/linked_list.hpp>
+#include <unittest/benchmark.hpp>
 
 #include "linked_list_test.hpp"
 
@@ -419,3 +420,18 @@ LinkedListTest::testInsert()
 		ii += 1;
 	}
 }
+
+void
+LinkedListTest::benchmarkAppendRemove()
+{
+	modm::LinkedList<int16_t> list;
+
+	int16_t value = 0;
+	unittest::benchmark("LinkedList::append+removeFront", [&]
+	{
+		list.append(value++);
+		unittest::doNotOptimize(list.getFront());
+		list.removeFront();
+	});
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
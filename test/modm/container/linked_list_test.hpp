@@ -65,4 +65,7 @@ public:
 
 	void
 	testInsert();
+
+	void
+	benchmarkAppendRemove();
 };
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "deferred_logger_test.hpp"
+
+#include <modm/debug/logger/deferred.hpp>
+#include <modm-test/mock/iodevice.hpp>
+#include <string.h>
+
+static modm_test::platform::IODevice device;
+
+void
+DeferredLoggerTest::testFormat()
+{
+	device.clear();
+	modm::IOStream stream(device);
+	modm::log::DeferredLogger<128> logger;
+
+	TEST_ASSERT_TRUE(logger.isEmpty());
+	TEST_ASSERT_TRUE(logger.log("start;"));
+	TEST_ASSERT_TRUE(logger.log("a=%d b=%u;", int16_t(-12), uint32_t(34)));
+	TEST_ASSERT_TRUE(logger.log("%s=%.2f", "x", 1.5f));
+	TEST_ASSERT_FALSE(logger.isEmpty());
+	// nothing is formatted until processed
+	TEST_ASSERT_EQUALS(device.bytesWritten, 0u);
+
+	TEST_ASSERT_EQUALS(logger.process(stream), 3u);
+	TEST_ASSERT_TRUE(logger.isEmpty());
+
+	const char expected[] = "start;a=-12 b=34;x=1.50";
+	TEST_ASSERT_EQUALS(device.bytesWritten, strlen(expected));
+	TEST_ASSERT_EQUALS_ARRAY(expected, device.buffer, strlen(expected));
+}
+
+void
+DeferredLoggerTest::testWrapAround()
+{
+	modm::IOStream stream(device);
+	modm::log::DeferredLogger<64> logger;
+
+	// records of 24 bytes on 64-bit hosts straddle the end of the buffer
+	for (uint8_t ii = 0; ii < 50; ii++)
+	{
+		device.clear();
+		TEST_ASSERT_TRUE(logger.log("%u", ii));
+		TEST_ASSERT_TRUE(logger.log("%u", uint8_t(ii + 1)));
+		TEST_ASSERT_EQUALS(logger.process(stream, 1), 1u);
+		TEST_ASSERT_EQUALS(logger.process(stream), 1u);
+
+		char expected[10];
+		const int length = snprintf(expected, sizeof(expected), "%u%u", ii, ii + 1);
+		TEST_ASSERT_EQUALS(device.bytesWritten, size_t(length));
+		TEST_ASSERT_EQUALS_ARRAY(expected, device.buffer, size_t(length));
+	}
+	TEST_ASSERT_EQUALS(logger.getDropped(), 0u);
+}
+
+void
+DeferredLoggerTest::testOverflow()
+{
+	modm::IOStream stream(device);
+	modm::log::DeferredLogger<64> logger;
+
+	size_t accepted{0};
+	for (uint8_t ii = 0; ii < 10; ii++) {
+		accepted += logger.log("%c", char('0' + ii));
+	}
+	TEST_ASSERT_TRUE(accepted < 10u);
+	TEST_ASSERT_EQUALS(logger.getDropped(), 10u - accepted);
+
+	// the oldest messages are kept
+	device.clear();
+	TEST_ASSERT_EQUALS(logger.process(stream), accepted);
+	TEST_ASSERT_EQUALS(device.bytesWritten, accepted);
+	TEST_ASSERT_EQUALS(device.buffer[0], '0');
+
+	// space is available again
+	TEST_ASSERT_TRUE(logger.log("%c", 'x'));
+	TEST_ASSERT_EQUALS(logger.process(stream), 1u);
+}
@@ -100,3 +100,88 @@ BlockAllocatorTest::testAlignment()
 
 	delete[] heap;
 }
+
+void
+BlockAllocatorTest::testReallocate()
+{
+	uint8_t *heap = new uint8_t[512];
+
+	modm::BlockAllocator<uint16_t, 8> allocator;
+	allocator.initialize(heap, heap + 512);
+
+	uint8_t *firstBlock = (uint8_t *) allocator.allocate(12);
+	for (uint8_t ii = 0; ii < 12; ++ii) {
+		firstBlock[ii] = ii;
+	}
+
+	// grow in place into the free slots above
+	TEST_ASSERT_TRUE(allocator.reallocate(firstBlock, 28) == firstBlock);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 464U);
+
+	// shrink in place
+	TEST_ASSERT_TRUE(allocator.reallocate(firstBlock, 12) == firstBlock);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 480U);
+
+	// the slots above are used, so the memory must be moved
+	void *secondBlock = allocator.allocate(12);
+	uint8_t *moved = (uint8_t *) allocator.reallocate(firstBlock, 60);
+	TEST_ASSERT_FALSE(moved == firstBlock);
+	TEST_ASSERT_FALSE(moved == secondBlock);
+	for (uint8_t ii = 0; ii < 12; ++ii) {
+		TEST_ASSERT_EQUALS(moved[ii], ii);
+	}
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 480U - 64U);
+
+	// too large requests leave the memory untouched
+	TEST_ASSERT_TRUE(allocator.reallocate(moved, 1000) == nullptr);
+	TEST_ASSERT_EQUALS(moved[11], 11U);
+
+	TEST_ASSERT_TRUE(allocator.reallocate(nullptr, 12) == firstBlock);
+
+	delete[] heap;
+}
+
+void
+BlockAllocatorTest::testStatistics()
+{
+	uint8_t *heap = new uint8_t[512];
+
+	modm::BlockAllocator<uint16_t, 8> allocator;
+	allocator.initialize(heap, heap + 512);
+
+	TEST_ASSERT_EQUALS(allocator.getUsedSize(), 0U);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 496U);
+	TEST_ASSERT_EQUALS(allocator.getFragmentation(), 0U);
+
+	void *blocks[8];
+	for (auto &block : blocks) {
+		block = allocator.allocate(12);
+	}
+	TEST_ASSERT_EQUALS(allocator.getUsedSize(), 128U);
+	TEST_ASSERT_EQUALS(allocator.getMaxUsedSize(), 128U);
+
+	// free every other block to fragment the memory
+	for (uint8_t ii = 0; ii < 8; ii += 2) {
+		allocator.free(blocks[ii]);
+	}
+	TEST_ASSERT_EQUALS(allocator.getUsedSize(), 64U);
+	TEST_ASSERT_EQUALS(allocator.getMaxUsedSize(), 128U);
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 432U);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 368U);
+	TEST_ASSERT_EQUALS(allocator.getFragmentation(), 15U);
+
+	// small allocations reuse the holes
+	void *hole = allocator.allocate(12);
+	TEST_ASSERT_TRUE(hole != nullptr);
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), 368U);
+	allocator.free(hole);
+
+	// freeing the remaining blocks merges all free runs again
+	for (uint8_t ii = 1; ii < 8; ii += 2) {
+		allocator.free(blocks[ii]);
+	}
+	TEST_ASSERT_EQUALS(allocator.getLargestFreeSize(), allocator.getAvailableSize());
+	TEST_ASSERT_EQUALS(allocator.getFragmentation(), 0U);
+
+	delete[] heap;
+}
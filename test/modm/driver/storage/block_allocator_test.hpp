@@ -32,6 +32,12 @@ public:
 
 	void
 	testAlignment();
+
+	void
+	testReallocate();
+
+	void
+	testStatistics();
 };
 
 #endif	// BLOCK_ALLOCATOR_TEST_HPP
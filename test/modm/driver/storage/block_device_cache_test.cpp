@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_cache_test.hpp"
+#include "shared.hpp"
+
+#include <modm/driver/storage/block_device_cache.hpp>
+
+namespace
+{
+
+using Device = CountingDevice<1024>;
+
+}
+
+void
+BlockDeviceCacheTest::testReadHit()
+{
+	modm::BdCache<Device, 4, 64> cache;
+	Device& device = cache.getBlockDevice();
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.initialize()));
+
+	uint8_t data[1024];
+	fill(data, sizeof(data), 0);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(data, 0, sizeof(data))));
+
+	uint8_t buffer[100];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 10, 4)));
+	TEST_ASSERT_EQUALS(device.reads, 1u);
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &data[10], 4);
+
+	// the same line is not read again
+	for (uint8_t ii = 0; ii < 10; ii++) {
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 3, 7)));
+	}
+	TEST_ASSERT_EQUALS(device.reads, 1u);
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &data[3], 7);
+
+	// across two lines, one of which is cached
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 20, 100)));
+	TEST_ASSERT_EQUALS(device.reads, 2u);
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &data[20], 100);
+
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(cache.read(buffer, 1000, 25)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(cache.read(buffer, 0, 0)));
+}
+
+void
+BlockDeviceCacheTest::testReadAhead()
+{
+	modm::BdCache<Device, 4, 64> cache;
+	Device& device = cache.getBlockDevice();
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.initialize()));
+
+	uint8_t data[1024];
+	fill(data, sizeof(data), 7);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(data, 0, sizeof(data))));
+
+	// random accesses do not read ahead
+	uint8_t buffer[16];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 512, 16)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 128, 16)));
+	TEST_ASSERT_EQUALS(device.reads, 2u);
+
+	cache.invalidate();
+	device.reads = 0;
+
+	// sequential accesses read the next line in advance
+	for (uint32_t address = 0; address < 256; address += sizeof(buffer))
+	{
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, address, sizeof(buffer))));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, &data[address], sizeof(buffer));
+	}
+	// lines 0-3 and line 4 read ahead
+	TEST_ASSERT_EQUALS(device.reads, 5u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 256, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &data[256], sizeof(buffer));
+	TEST_ASSERT_EQUALS(device.reads, 6u);
+
+	// no read ahead beyond the end of the device
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 1024 - 32, sizeof(buffer))));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 1024 - 16, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &data[1024 - 16], sizeof(buffer));
+	TEST_ASSERT_EQUALS(device.reads, 7u);
+}
+
+void
+BlockDeviceCacheTest::testProgramCoalescing()
+{
+	modm::BdCache<Device, 4, 64> cache;
+	Device& device = cache.getBlockDevice();
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.initialize()));
+
+	uint8_t data[64];
+	fill(data, sizeof(data), 1);
+	for (uint8_t ii = 0; ii < 8; ii++) {
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(&data[ii * 8], 64 + ii * 8, 8)));
+	}
+	TEST_ASSERT_EQUALS(device.programs, 0u);
+	TEST_ASSERT_EQUALS(device.reads, 1u);
+
+	// lines which are programmed completely are not read first
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(data, 384, sizeof(data))));
+	TEST_ASSERT_EQUALS(device.reads, 1u);
+
+	// reads return the cached data
+	uint8_t buffer[64];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 64, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.flush()));
+	TEST_ASSERT_EQUALS(device.programs, 2u);
+	TEST_ASSERT_EQUALS(device.lastAddress, 384u);
+	TEST_ASSERT_EQUALS(device.lastSize, 64u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 64, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+
+	// nothing left to flush
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.flush()));
+	TEST_ASSERT_EQUALS(device.programs, 2u);
+
+	// programs with a gap are not merged
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(data, 256, 8)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(data, 256 + 8, 8)));
+	TEST_ASSERT_EQUALS(device.programs, 2u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(data, 256 + 32, 8)));
+	TEST_ASSERT_EQUALS(device.programs, 3u);
+	TEST_ASSERT_EQUALS(device.lastAddress, 256u);
+	TEST_ASSERT_EQUALS(device.lastSize, 16u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.deinitialize()));
+	TEST_ASSERT_EQUALS(device.programs, 4u);
+	TEST_ASSERT_EQUALS(device.lastAddress, 256u + 32);
+	TEST_ASSERT_EQUALS(device.lastSize, 8u);
+}
+
+void
+BlockDeviceCacheTest::testReplacement()
+{
+	modm::BdCache<Device, 2, 64> cache;
+	Device& device = cache.getBlockDevice();
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.initialize()));
+
+	uint8_t buffer[4];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 0, 4)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(buffer, 128, 4)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 0, 4)));
+	TEST_ASSERT_EQUALS(device.reads, 2u);
+
+	// replaces the dirty line 128, which was used least recently
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 512, 4)));
+	TEST_ASSERT_EQUALS(device.reads, 3u);
+	TEST_ASSERT_EQUALS(device.programs, 1u);
+	TEST_ASSERT_EQUALS(device.lastAddress, 128u);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 0, 4)));
+	TEST_ASSERT_EQUALS(device.reads, 3u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 128, 4)));
+	TEST_ASSERT_EQUALS(device.reads, 4u);
+}
+
+void
+BlockDeviceCacheTest::testErase()
+{
+	modm::BdCache<Device, 4, 64> cache;
+	Device& device = cache.getBlockDevice();
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.initialize()));
+
+	uint8_t data[16];
+	fill(data, sizeof(data), 3);
+
+	// programs in the erased area are dropped
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(data, 0, sizeof(data))));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.erase(0, 64)));
+	TEST_ASSERT_EQUALS(device.erases, 1u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.flush()));
+	TEST_ASSERT_EQUALS(device.programs, 0u);
+
+	// programs outside of it are kept
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.program(data, 64, sizeof(data))));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.erase(72, 8)));
+	TEST_ASSERT_EQUALS(device.programs, 1u);
+	TEST_ASSERT_EQUALS(device.erases, 2u);
+
+	// the erased line is read again
+	const uint32_t reads = device.reads;
+	uint8_t buffer[16];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 64, 8)));
+	TEST_ASSERT_EQUALS(device.reads, reads + 1);
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, 8);
+
+	// write erases and programs
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.write(data, 512, sizeof(data))));
+	TEST_ASSERT_EQUALS(device.erases, 3u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 512, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_file_test.hpp"
+#include "shared.hpp"
+
+#include <modm/debug/logger.hpp>
+#include <modm/driver/storage/block_device_file_mapped.hpp>
+#include <modm/driver/storage/block_device_file_uring.hpp>
+#include <cerrno>
+#include <unistd.h>
+
+namespace
+{
+
+struct Filename
+{
+	static constexpr const char* name = "modm_block_device_file_test.bin";
+};
+
+constexpr size_t DeviceSize = 4096;
+
+/// io_uring is disabled in some kernels and container sandboxes
+bool
+isUringUnavailable(const char* test)
+{
+	if (errno != ENOSYS and errno != EPERM) {
+		return false;
+	}
+	MODM_LOG_WARNING << test << " skipped: io_uring is not available" << modm::endl;
+	return true;
+}
+
+}
+
+void
+BlockDeviceFileTest::tearDown()
+{
+	::unlink(Filename::name);
+}
+
+void
+BlockDeviceFileTest::testMappedReadProgram()
+{
+	modm::BdFileMapped<Filename, DeviceSize> device;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+
+	// a new file reads as zeros
+	uint8_t buffer[256];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 0, sizeof(buffer))));
+	for (uint8_t value : buffer) {
+		TEST_ASSERT_EQUALS(value, 0);
+	}
+
+	uint8_t data[256];
+	fill(data, sizeof(data), 3);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.write(data, 1000, sizeof(data))));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 1000, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+
+	// zero-copy access to the same data
+	const uint8_t* pointer = device.getPointer(1000, sizeof(data));
+	TEST_ASSERT_TRUE(pointer != nullptr);
+	TEST_ASSERT_EQUALS_ARRAY(pointer, data, sizeof(data));
+
+	TEST_ASSERT_TRUE(device.getPointer(DeviceSize - 1) != nullptr);
+	TEST_ASSERT_TRUE(device.getPointer(DeviceSize - 1, 2) == nullptr);
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.read(buffer, DeviceSize - 1, 2)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.program(data, DeviceSize, 1)));
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.flush()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+	TEST_ASSERT_TRUE(device.getPointer(0) == nullptr);
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.read(buffer, 0, 1)));
+}
+
+void
+BlockDeviceFileTest::testMappedPersistence()
+{
+	uint8_t data[128];
+	fill(data, sizeof(data), 42);
+	{
+		modm::BdFileMapped<Filename, DeviceSize> device;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(data, DeviceSize - sizeof(data), sizeof(data))));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+	}
+	{
+		// the destructor writes back a device that is still mapped
+		modm::BdFileMapped<Filename, DeviceSize> device;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(data, 0, sizeof(data))));
+	}
+	{
+		// the io_uring backend reads the same file format
+		modm::BdFileUring<Filename, DeviceSize> device;
+		const bool initialized = RF_CALL_BLOCKING(device.initialize());
+		if (not initialized and isUringUnavailable("testMappedPersistence")) {
+			return;
+		}
+		TEST_ASSERT_TRUE(initialized);
+		uint8_t buffer[128];
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, DeviceSize - sizeof(buffer), sizeof(buffer))));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 0, sizeof(buffer))));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+	}
+	{
+		// a file of a different size is rejected
+		modm::BdFileMapped<Filename, DeviceSize * 2> device;
+		TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.initialize()));
+	}
+}
+
+void
+BlockDeviceFileTest::testUringReadProgram()
+{
+	modm::BdFileUring<Filename, DeviceSize> device;
+	const bool initialized = RF_CALL_BLOCKING(device.initialize());
+	if (not initialized and isUringUnavailable("testUringReadProgram")) {
+		return;
+	}
+	TEST_ASSERT_TRUE(initialized);
+
+	uint8_t data[512];
+	fill(data, sizeof(data), 9);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.write(data, 512, sizeof(data))));
+
+	uint8_t buffer[512]{};
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 512, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.read(buffer, DeviceSize - 1, 2)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.program(data, 0, 0)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.flush()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+}
+
+void
+BlockDeviceFileTest::testUringBatch()
+{
+	modm::BdFileUring<Filename, DeviceSize, 8> device;
+	const bool initialized = RF_CALL_BLOCKING(device.initialize());
+	if (not initialized and isUringUnavailable("testUringBatch")) {
+		return;
+	}
+	TEST_ASSERT_TRUE(initialized);
+
+	uint8_t data[8][64];
+	for (uint8_t ii = 0; ii < 8; ii++)
+	{
+		fill(data[ii], sizeof(data[ii]), ii);
+		TEST_ASSERT_TRUE(device.queueProgram(data[ii], ii * 512, sizeof(data[ii])));
+	}
+	// the queue is full
+	TEST_ASSERT_FALSE(device.queueProgram(data[0], 0, sizeof(data[0])));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.complete()));
+
+	uint8_t buffer[8][64]{};
+	for (uint8_t ii = 0; ii < 8; ii++) {
+		TEST_ASSERT_TRUE(device.queueRead(buffer[ii], ii * 512, sizeof(buffer[ii])));
+	}
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.complete()));
+	for (uint8_t ii = 0; ii < 8; ii++) {
+		TEST_ASSERT_EQUALS_ARRAY(buffer[ii], data[ii], sizeof(data[ii]));
+	}
+
+	TEST_ASSERT_FALSE(device.queueRead(buffer[0], DeviceSize, 1));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+}
+
+void
+BlockDeviceFileTest::testUringBatchOverlap()
+{
+	modm::BdFileUring<Filename, DeviceSize, 8> device;
+	const bool initialized = RF_CALL_BLOCKING(device.initialize());
+	if (not initialized and isUringUnavailable("testUringBatchOverlap")) {
+		return;
+	}
+	TEST_ASSERT_TRUE(initialized);
+
+	uint8_t data[2][512];
+	fill(data[0], sizeof(data[0]), 5);
+	fill(data[1], sizeof(data[1]), 77);
+	uint8_t buffer[3][512]{};
+	for (uint8_t ii = 0; ii < 16; ii++)
+	{
+		// the reads must see the program operations queued before them
+		const uint8_t* program = data[ii % 2];
+		TEST_ASSERT_TRUE(device.queueProgram(program, 1024, 512));
+		TEST_ASSERT_TRUE(device.queueRead(buffer[0], 1024, 512));
+		TEST_ASSERT_TRUE(device.queueRead(buffer[1], 1024 + 256, 512));
+		TEST_ASSERT_TRUE(device.queueProgram(data[0], 2048, 512));
+		TEST_ASSERT_TRUE(device.queueRead(buffer[2], 2048, 512));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.complete()));
+
+		TEST_ASSERT_EQUALS_ARRAY(buffer[0], program, 512);
+		TEST_ASSERT_EQUALS_ARRAY(buffer[1], program + 256, 256);
+		TEST_ASSERT_EQUALS_ARRAY(buffer[2], data[0], 512);
+	}
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.flush()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+}
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_ftl_test.hpp"
+
+#include <modm/driver/storage/block_device_ftl.hpp>
+#include <modm/driver/storage/block_device_heap.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+/// NOR flash emulation on a heap block device, which erases to 0xff, keeps
+/// its contents across instances and loses power after a number of operations
+class Flash : public modm::BlockDevice
+{
+	using Heap = modm::BdHeap<8 * 1024, true>;
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 16;
+	static constexpr bd_size_t BlockSizeErase = 1024;
+	static constexpr bd_size_t DeviceSize = Heap::DeviceSize;
+
+	static inline uint8_t memory[DeviceSize];
+	static inline uint32_t eraseCounts[DeviceSize / BlockSizeErase];
+	/// Programs to bytes which were not erased
+	static inline uint32_t violations;
+	/// Number of programs and erases until the power fails, negative to disable
+	static inline int32_t powerFailure;
+
+	static void
+	reset(uint8_t value)
+	{
+		std::memset(memory, value, sizeof(memory));
+		std::fill(std::begin(eraseCounts), std::end(eraseCounts), 0);
+		violations = 0;
+		powerFailure = -1;
+	}
+
+	modm::ResumableResult<bool>
+	initialize()
+	{ return heap.initialize(memory); }
+
+	modm::ResumableResult<bool>
+	deinitialize()
+	{ return heap.deinitialize(); }
+
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		if (powerFailure == 0) return {modm::rf::Stop, false};
+		return heap.read(buffer, address, size);
+	}
+
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		if (powerFailure == 0 or size % BlockSizeWrite or address % BlockSizeWrite) {
+			return {modm::rf::Stop, false};
+		}
+		for (bd_size_t ii = 0; ii < size and address + ii < DeviceSize; ii++) {
+			if (memory[address + ii] != 0xff) violations++;
+		}
+		// the power fails in the middle of the operation
+		if (powerFails())
+		{
+			RF_CALL_BLOCKING(heap.program(buffer, address, size / 2));
+			return {modm::rf::Stop, false};
+		}
+		return heap.program(buffer, address, size);
+	}
+
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size)
+	{
+		if (powerFailure == 0 or size % BlockSizeErase or address % BlockSizeErase) {
+			return {modm::rf::Stop, false};
+		}
+		static uint8_t erased[BlockSizeErase];
+		std::memset(erased, 0xff, sizeof(erased));
+		const bool fails = powerFails();
+		for (bd_size_t ii = 0; ii < size; ii += BlockSizeErase)
+		{
+			if (not RF_CALL_BLOCKING(heap.program(erased, address + ii, fails ? BlockSizeErase / 2 : BlockSizeErase))) {
+				return {modm::rf::Stop, false};
+			}
+			if (not fails) eraseCounts[(address + ii) / BlockSizeErase]++;
+		}
+		return {modm::rf::Stop, not fails};
+	}
+
+private:
+	static bool
+	powerFails()
+	{
+		return (powerFailure > 0) and (--powerFailure == 0);
+	}
+
+	Heap heap;
+};
+
+// 8 erase blocks with 15 slots of 64 bytes each
+using Ftl = modm::BdFtl<Flash, 48, 64 * 48>;
+constexpr uint32_t Blocks = Ftl::DeviceSize / Ftl::BlockSizeWrite;
+
+void
+fill(uint8_t* buffer, uint32_t block, uint32_t version)
+{
+	for (uint32_t ii = 0; ii < Ftl::BlockSizeWrite; ii++) {
+		buffer[ii] = uint8_t(block * 7 + version * 13 + ii);
+	}
+}
+
+bool
+contains(Ftl& ftl, uint32_t block, uint32_t version)
+{
+	uint8_t expected[Ftl::BlockSizeWrite];
+	uint8_t buffer[Ftl::BlockSizeWrite];
+	fill(expected, block, version);
+	return RF_CALL_BLOCKING(ftl.read(buffer, block * Ftl::BlockSizeWrite, sizeof(buffer))) and
+		   std::memcmp(buffer, expected, sizeof(buffer)) == 0;
+}
+
+bool
+write(Ftl& ftl, uint32_t block, uint32_t version)
+{
+	uint8_t buffer[Ftl::BlockSizeWrite];
+	fill(buffer, block, version);
+	return RF_CALL_BLOCKING(ftl.program(buffer, block * Ftl::BlockSizeWrite, sizeof(buffer)));
+}
+
+uint32_t
+erases()
+{
+	uint32_t sum = 0;
+	for (uint32_t count : Flash::eraseCounts) sum += count;
+	return sum;
+}
+
+}
+
+void
+BlockDeviceFtlTest::setUp()
+{
+	Flash::reset(0xff);
+}
+
+void
+BlockDeviceFtlTest::testProgramRead()
+{
+	// an unformatted device
+	Flash::reset(0x00);
+	Ftl ftl;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.initialize()));
+
+	// unmapped blocks read as erased
+	uint8_t buffer[100];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.read(buffer, 10, sizeof(buffer))));
+	TEST_ASSERT_TRUE(std::all_of(std::begin(buffer), std::end(buffer), [](uint8_t v) { return v == 0xff; }));
+
+	for (uint32_t block = 0; block < Blocks; block++) {
+		TEST_ASSERT_TRUE(write(ftl, block, 1));
+	}
+	// programmed without erasing the blocks
+	TEST_ASSERT_TRUE(write(ftl, 3, 2));
+	for (uint32_t block = 0; block < Blocks; block++) {
+		TEST_ASSERT_TRUE(contains(ftl, block, block == 3 ? 2 : 1));
+	}
+
+	// reads across logical blocks
+	uint8_t expected[Ftl::BlockSizeWrite];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.read(buffer, 20, sizeof(buffer))));
+	fill(expected, 0, 1);
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &expected[20], Ftl::BlockSizeWrite - 20);
+	fill(expected, 1, 1);
+	TEST_ASSERT_EQUALS_ARRAY(&buffer[Ftl::BlockSizeWrite - 20], expected, Ftl::BlockSizeWrite);
+	fill(expected, 2, 1);
+	TEST_ASSERT_EQUALS_ARRAY(&buffer[2 * Ftl::BlockSizeWrite - 20], expected, 100 + 20 - 2 * Ftl::BlockSizeWrite);
+
+	// erasing unmaps the blocks
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.erase(Ftl::BlockSizeErase, 2 * Ftl::BlockSizeErase)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.read(buffer, Ftl::BlockSizeErase, 2 * Ftl::BlockSizeErase)));
+	TEST_ASSERT_TRUE(std::all_of(buffer, buffer + 2 * Ftl::BlockSizeErase, [](uint8_t v) { return v == 0xff; }));
+
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(ftl.program(buffer, 1, Ftl::BlockSizeWrite)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(ftl.program(buffer, 0, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(ftl.read(buffer, Ftl::DeviceSize - 1, 2)));
+	TEST_ASSERT_EQUALS(Flash::violations, 0u);
+}
+
+void
+BlockDeviceFtlTest::testRemount()
+{
+	{
+		Ftl ftl;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.initialize()));
+		for (uint32_t version = 1; version <= 5; version++)
+		{
+			for (uint32_t block = 0; block < Blocks; block += version) {
+				TEST_ASSERT_TRUE(write(ftl, block, version));
+			}
+		}
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.deinitialize()));
+	}
+	Ftl ftl;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.initialize()));
+	for (uint32_t block = 0; block < Blocks; block++)
+	{
+		uint32_t version = 1;
+		for (uint32_t ii = 1; ii <= 5; ii++) {
+			if (block % ii == 0) version = ii;
+		}
+		TEST_ASSERT_TRUE(contains(ftl, block, version));
+	}
+
+	// the remounted device continues to work
+	for (uint32_t ii = 0; ii < 200; ii++) {
+		TEST_ASSERT_TRUE(write(ftl, ii % 4, ii));
+	}
+	TEST_ASSERT_TRUE(contains(ftl, 3, 199));
+	TEST_ASSERT_TRUE(contains(ftl, 4, 4));
+	TEST_ASSERT_EQUALS(Flash::violations, 0u);
+}
+
+void
+BlockDeviceFtlTest::testWearLeveling()
+{
+	Ftl ftl;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.initialize()));
+
+	// static data on most of the device and a few hot blocks
+	for (uint32_t block = 0; block < Blocks; block++) {
+		TEST_ASSERT_TRUE(write(ftl, block, 0));
+	}
+	for (uint32_t ii = 0; ii < 5000; ii++) {
+		TEST_ASSERT_TRUE(write(ftl, ii % 3, ii));
+	}
+
+	for (uint32_t block = 0; block < Blocks; block++) {
+		TEST_ASSERT_TRUE(contains(ftl, block, block < 3 ? 4999 - (4999 - block) % 3 : 0));
+	}
+	const auto [minimum, maximum] = std::minmax_element(std::begin(Flash::eraseCounts),
+														std::end(Flash::eraseCounts));
+	TEST_ASSERT_TRUE(*maximum - *minimum <= Ftl::WearLevelingThreshold + 2);
+	TEST_ASSERT_EQUALS(Flash::violations, 0u);
+}
+
+void
+BlockDeviceFtlTest::testBackgroundCollection()
+{
+	Ftl ftl;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.initialize()));
+
+	// formats the device in the background
+	TEST_ASSERT_TRUE(ftl.needsGarbageCollection());
+	while (ftl.needsGarbageCollection()) {
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.collectGarbage()));
+	}
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(ftl.collectGarbage()));
+
+	TEST_ASSERT_EQUALS(erases(), Flash::DeviceSize / Flash::BlockSizeErase);
+
+	for (uint32_t ii = 0; ii < 1000; ii++)
+	{
+		// programs never have to wait for an erase
+		const uint32_t before = erases();
+		TEST_ASSERT_TRUE(write(ftl, ii % 10, ii));
+		TEST_ASSERT_EQUALS(erases(), before);
+
+		while (ftl.needsGarbageCollection()) {
+			TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.collectGarbage()));
+		}
+	}
+	for (uint32_t block = 0; block < 10; block++) {
+		TEST_ASSERT_TRUE(contains(ftl, block, 990 + block));
+	}
+	TEST_ASSERT_EQUALS(Flash::violations, 0u);
+}
+
+void
+BlockDeviceFtlTest::testPowerLoss()
+{
+	for (int32_t failure = 1; failure < 300; failure += 3)
+	{
+		Flash::reset(0xff);
+		uint32_t versions[Blocks];
+		{
+			Ftl ftl;
+			TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.initialize()));
+			for (uint32_t block = 0; block < Blocks; block++)
+			{
+				TEST_ASSERT_TRUE(write(ftl, block, 1));
+				versions[block] = 1;
+			}
+
+			// write until the power fails
+			Flash::powerFailure = failure;
+			uint32_t block = 0;
+			for (uint32_t ii = 0; ii < 4 * Blocks; ii++, block = (block + 5) % Blocks)
+			{
+				if (not write(ftl, block, versions[block] + 1)) break;
+				versions[block]++;
+			}
+		}
+		Flash::powerFailure = -1;
+
+		// all blocks, which were programmed successfully, are restored
+		Ftl ftl;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(ftl.initialize()));
+		for (uint32_t block = 0; block < Blocks; block++)
+		{
+			if (not contains(ftl, block, versions[block]))
+			{
+				// only the interrupted program may have succeeded
+				TEST_ASSERT_TRUE(contains(ftl, block, versions[block] + 1));
+				versions[block]++;
+			}
+		}
+
+		// and the device continues to work
+		for (uint32_t ii = 0; ii < 2 * Blocks; ii++)
+		{
+			const uint32_t block = (ii * 3) % Blocks;
+			TEST_ASSERT_TRUE(write(ftl, block, ++versions[block]));
+		}
+		for (uint32_t block = 0; block < Blocks; block++) {
+			TEST_ASSERT_TRUE(contains(ftl, block, versions[block]));
+		}
+		TEST_ASSERT_EQUALS(Flash::violations, 0u);
+	}
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_mirror_test.hpp"
+#include "shared.hpp"
+
+#include <modm/driver/storage/block_device_mirror.hpp>
+
+namespace
+{
+
+using Device = CountingDevice<256>;
+
+/// Counting block device, which reports a settable busy state
+class BusyDevice : public Device
+{
+public:
+	modm::ResumableResult<bool>
+	isBusy()
+	{
+		RF_BEGIN();
+		RF_END_RETURN(busy);
+	}
+
+	bool busy{false};
+};
+
+}
+
+void
+BlockDeviceMirrorTest::testWrite()
+{
+	modm::BdMirror<Device, Device> mirror;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.initialize()));
+
+	uint8_t data[64];
+	fill(data, sizeof(data), 3);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.program(data, 32, sizeof(data))));
+
+	uint8_t buffer[64];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.getBlockDeviceA().read(buffer, 32, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.getBlockDeviceB().read(buffer, 32, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+}
+
+void
+BlockDeviceMirrorTest::testReadBalancing()
+{
+	modm::BdMirror<Device, Device> mirror;
+	Device& deviceA = mirror.getBlockDeviceA();
+	Device& deviceB = mirror.getBlockDeviceB();
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.initialize()));
+
+	uint8_t data[256];
+	fill(data, sizeof(data), 0);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.program(data, 0, sizeof(data))));
+
+	uint8_t buffer[16];
+	for (uint8_t ii = 0; ii < 8; ii++)
+	{
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.read(buffer, ii * 16, sizeof(buffer))));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, &data[ii * 16], sizeof(buffer));
+	}
+	TEST_ASSERT_EQUALS(deviceA.reads, 4u);
+	TEST_ASSERT_EQUALS(deviceB.reads, 4u);
+}
+
+void
+BlockDeviceMirrorTest::testReadBusy()
+{
+	modm::BdMirror<BusyDevice, BusyDevice> mirror;
+	BusyDevice& deviceA = mirror.getBlockDeviceA();
+	BusyDevice& deviceB = mirror.getBlockDeviceB();
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.initialize()));
+
+	uint8_t buffer[16];
+	deviceB.busy = true;
+	for (uint8_t ii = 0; ii < 4; ii++) {
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.read(buffer, 0, sizeof(buffer))));
+	}
+	TEST_ASSERT_EQUALS(deviceA.reads, 4u);
+	TEST_ASSERT_EQUALS(deviceB.reads, 0u);
+
+	deviceA.busy = true;
+	deviceB.busy = false;
+	for (uint8_t ii = 0; ii < 4; ii++) {
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.read(buffer, 0, sizeof(buffer))));
+	}
+	TEST_ASSERT_EQUALS(deviceA.reads, 4u);
+	TEST_ASSERT_EQUALS(deviceB.reads, 4u);
+
+	// both busy: keep alternating
+	deviceB.busy = true;
+	for (uint8_t ii = 0; ii < 4; ii++) {
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(mirror.read(buffer, 0, sizeof(buffer))));
+	}
+	TEST_ASSERT_EQUALS(deviceA.reads, 6u);
+	TEST_ASSERT_EQUALS(deviceB.reads, 6u);
+}
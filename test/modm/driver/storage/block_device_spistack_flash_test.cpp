@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_spistack_flash_test.hpp"
+#include "shared.hpp"
+
+#include <cstring>
+#include <modm/driver/storage/block_device_spistack_flash.hpp>
+
+namespace
+{
+
+/// Stack of two dies in RAM, which logs the operations on the dies
+class FakeStack : public modm::BlockDevice, protected modm::NestedResumable<1>
+{
+public:
+	struct Operation
+	{
+		char type;
+		uint8_t die;
+		bd_address_t address;
+		bd_size_t size;
+	};
+
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 16;
+	static constexpr bd_size_t BlockSizeErase = 64;
+	static constexpr bd_size_t DeviceSize = 256;
+	static constexpr uint8_t Dies = 2;
+
+	modm::ResumableResult<bool>
+	initialize()
+	{
+		RF_BEGIN();
+		std::memset(memory, 0, sizeof(memory));
+		operations = 0;
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<bool>
+	deinitialize()
+	{
+		RF_BEGIN();
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<void>
+	selectDie(uint8_t die)
+	{
+		RF_BEGIN();
+		selected = die;
+		RF_END();
+	}
+
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		RF_BEGIN();
+		log('r', address, size);
+		std::memcpy(buffer, &memory[selected][address], size);
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		RF_BEGIN();
+		log('p', address, size);
+		std::memcpy(&memory[selected][address], buffer, size);
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size)
+	{
+		RF_BEGIN();
+		log('e', address, size);
+		std::memset(&memory[selected][address], 0xff, size);
+		RF_END_RETURN(true);
+	}
+
+	static inline uint8_t memory[Dies][DeviceSize];
+	static inline Operation operation[16];
+	static inline uint8_t operations;
+
+private:
+	void
+	log(char type, bd_address_t address, bd_size_t size)
+	{
+		if (operations < 16) {
+			operation[operations++] = {type, selected, address, size};
+		}
+	}
+
+	uint8_t selected{0};
+};
+
+void
+assertOperation(uint8_t index, char type, uint8_t die, uint32_t address, uint32_t size)
+{
+	TEST_ASSERT_EQUALS(FakeStack::operation[index].type, type);
+	TEST_ASSERT_EQUALS(FakeStack::operation[index].die, die);
+	TEST_ASSERT_EQUALS(FakeStack::operation[index].address, address);
+	TEST_ASSERT_EQUALS(FakeStack::operation[index].size, size);
+}
+
+}
+
+void
+BlockDeviceSpiStackFlashTest::testConcatenated()
+{
+	modm::BdSpiStackFlash<FakeStack, 2> stack;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.initialize()));
+
+	uint8_t data[128];
+	fill(data, sizeof(data), 7);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.write(data, 192, sizeof(data))));
+	TEST_ASSERT_EQUALS_ARRAY(&FakeStack::memory[0][192], &data[0], 64);
+	TEST_ASSERT_EQUALS_ARRAY(&FakeStack::memory[1][0], &data[64], 64);
+
+	TEST_ASSERT_EQUALS(FakeStack::operations, 4u);
+	assertOperation(0, 'e', 0, 192, 64);
+	assertOperation(1, 'e', 1, 0, 64);
+	assertOperation(2, 'p', 0, 192, 64);
+	assertOperation(3, 'p', 1, 0, 64);
+
+	uint8_t buffer[100];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.read(buffer, 200, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &data[8], sizeof(buffer));
+}
+
+void
+BlockDeviceSpiStackFlashTest::testStriped()
+{
+	modm::BdSpiStackFlash<FakeStack, 2, 64> stack;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.initialize()));
+
+	uint8_t data[512];
+	fill(data, sizeof(data), 0);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.erase(0, sizeof(data))));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.program(data, 0, sizeof(data))));
+
+	for (uint32_t address = 0; address < sizeof(data); address += 64)
+	{
+		const uint8_t die = (address / 64) % 2;
+		const uint32_t dieAddress = (address / 128) * 64;
+		TEST_ASSERT_EQUALS_ARRAY(&FakeStack::memory[die][dieAddress], &data[address], 64);
+	}
+
+	uint8_t buffer[200];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.read(buffer, 30, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, &data[30], sizeof(buffer));
+
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(stack.read(buffer, 400, sizeof(buffer))));
+}
+
+void
+BlockDeviceSpiStackFlashTest::testStripedWrite()
+{
+	modm::BdSpiStackFlash<FakeStack, 2, 64> stack;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.initialize()));
+
+	uint8_t data[256];
+	fill(data, sizeof(data), 11);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.write(data, 128, sizeof(data))));
+
+	// every program is preceded by an erase on the other die
+	TEST_ASSERT_EQUALS(FakeStack::operations, 8u);
+	assertOperation(0, 'e', 0, 64, 64);
+	assertOperation(1, 'e', 1, 64, 64);
+	assertOperation(2, 'p', 0, 64, 64);
+	assertOperation(3, 'e', 0, 128, 64);
+	assertOperation(4, 'p', 1, 64, 64);
+	assertOperation(5, 'e', 1, 128, 64);
+	assertOperation(6, 'p', 0, 128, 64);
+	assertOperation(7, 'p', 1, 128, 64);
+
+	uint8_t buffer[256];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(stack.read(buffer, 128, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(buffer));
+}
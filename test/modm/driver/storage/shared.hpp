@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+#include <modm/driver/storage/block_device_heap.hpp>
+#include <stddef.h>
+#include <stdint.h>
+
+// helpers shared by the block device tests
+
+/// Heap block device, which counts the accesses
+template< size_t Size >
+class CountingDevice : public modm::BdHeap<Size>
+{
+	using Heap = modm::BdHeap<Size>;
+
+public:
+	using typename Heap::bd_address_t;
+	using typename Heap::bd_size_t;
+
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		reads++;
+		return Heap::read(buffer, address, size);
+	}
+
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		programs++;
+		lastAddress = address;
+		lastSize = size;
+		return Heap::program(buffer, address, size);
+	}
+
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size)
+	{
+		erases++;
+		return Heap::erase(address, size);
+	}
+
+	uint32_t reads{0};
+	uint32_t programs{0};
+	uint32_t erases{0};
+	bd_address_t lastAddress{0};
+	bd_size_t lastSize{0};
+};
+
+/// Fills the buffer with a pattern that differs for every seed
+inline void
+fill(uint8_t* buffer, size_t size, uint8_t seed)
+{
+	for (size_t ii = 0; ii < size; ii++) {
+		buffer[ii] = uint8_t(seed + ii);
+	}
+}
@@ -19,6 +19,7 @@
 
 #include <modm/architecture/utils.hpp> // MODM_ARRAY_SIZE
 #include <modm-test/mock/iodevice.hpp>
+#include <unittest/benchmark.hpp>
 #include <stdio.h>	// snprintf
 #include <string.h>	// memset
 #include <limits>
@@ -623,3 +624,39 @@ IoStreamTest::testPointer()
 	TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, bytesWritten);
 	TEST_ASSERT_EQUALS(device.bytesWritten, bytesWritten);
 }
+
+// ----------------------------------------------------------------------------
+void
+IoStreamTest::benchmarkInteger()
+{
+	uint32_t value = 4'000'000'000;
+	unittest::benchmark("IOStream<<uint32_t", [&]
+	{
+		device.bytesWritten = 0;
+		(*stream) << value++;
+	});
+}
+
+void
+IoStreamTest::benchmarkFloat()
+{
+	float value = 1.2345f;
+	unittest::benchmark("IOStream<<float", [&]
+	{
+		device.bytesWritten = 0;
+		(*stream) << value;
+		value += 0.5f;
+	});
+}
+
+void
+IoStreamTest::benchmarkPrintf()
+{
+	int value = -10'000;
+	unittest::benchmark("IOStream::printf", [&]
+	{
+		device.bytesWritten = 0;
+		stream->printf("%d: %5u %s", value, unsigned(value), "abc");
+		value++;
+	});
+}
@@ -169,6 +169,15 @@ public:
 	void
 	testPointer();
 
+	void
+	benchmarkInteger();
+
+	void
+	benchmarkFloat();
+
+	void
+	benchmarkPrintf();
+
 private:
 	modm::IOStream *stream;
 };
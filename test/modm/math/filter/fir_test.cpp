@@ -14,6 +14,8 @@
 
 #include <modm/math/filter/fir.hpp>
 
+#include <unittest/benchmark.hpp>
+
 #include "fir_test.hpp"
 
 
@@ -44,6 +46,109 @@ FirTest::testFir()
 	testFilter<int, 5, 2, 10>(delay_line_coeffs, delay_line_taps, 5, delay_line_results);
 }
 
+static constexpr float block_coeffs[13] = {
+	0.01f, -0.02f, 0.04f, -0.08f, 0.15f, 0.22f, 0.3f,
+	0.22f, 0.15f, -0.08f, 0.04f, -0.02f, 0.01f};
+
+void
+FirTest::testFirBlock()
+{
+	testBlock<int16_t, 13, 4, 1000>(block_coeffs);
+	testBlock<int32_t, 13, 8, 10000>(block_coeffs);
+	testBlock<float, 13, 8, 1>(block_coeffs);
+}
+
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+FirTest::testBlock(const float (&coeff)[N])
+{
+	modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor> filter(coeff);
+	modm::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor> block(coeff);
+
+	uint16_t seed = 0x2f3a;
+	for(int b = 0; b < 5; b++)
+	{
+		T input[BLOCK_SIZE];
+		for(int i = 0; i < BLOCK_SIZE; i++){
+			seed = seed * 25173 + 13849;
+			input[i] = static_cast<T>(int16_t(seed) / 64);
+		}
+		T result[BLOCK_SIZE];
+		block.process(input, result);
+
+		for(int i = 0; i < BLOCK_SIZE; i++){
+			filter.append(input[i]);
+			filter.update();
+			TEST_ASSERT_EQUALS(result[i], filter.getValue());
+		}
+		TEST_ASSERT_EQUALS(block.getValue(), filter.getValue());
+	}
+}
+
+void
+FirTest::testDotProduct()
+{
+	int16_t taps16[37], coeffs16[37];
+	int32_t taps32[37], coeffs32[37];
+	float tapsf[37], coeffsf[37];
+	for(int i = 0; i < 37; i++){
+		// large values overflow the accumulator, which must wrap identically
+		taps16[i] = int16_t(i * 1871 - 30000);
+		coeffs16[i] = int16_t(29000 - i * 1511);
+		taps32[i] = i * 1871 - 30000;
+		coeffs32[i] = 290 - i * 15;
+		tapsf[i] = i * 0.25f - 4.f;
+		coeffsf[i] = 1.f / (i + 1);
+	}
+	using namespace modm::filter::fir;
+	TEST_ASSERT_EQUALS((dotProduct<int16_t, 37>(taps16, coeffs16)),
+					   (dotProductScalar<int16_t, 37>(taps16, coeffs16)));
+	TEST_ASSERT_EQUALS((dotProduct<int16_t, 5>(taps16 + 1, coeffs16)),
+					   (dotProductScalar<int16_t, 5>(taps16 + 1, coeffs16)));
+	TEST_ASSERT_EQUALS((dotProduct<int32_t, 37>(taps32, coeffs32)),
+					   (dotProductScalar<int32_t, 37>(taps32, coeffs32)));
+	TEST_ASSERT_EQUALS_DELTA((dotProduct<float, 37>(tapsf, coeffsf)),
+							 (dotProductScalar<float, 37>(tapsf, coeffsf)), 1e-4f);
+}
+
+void
+FirTest::benchmarkDotProduct()
+{
+	constexpr int N = 64;
+	float taps[N + 32], coeffs[N];
+	for(int i = 0; i < N; i++) { coeffs[i] = 1.f / (i + 1); }
+	for(int i = 0; i < N + 32; i++) { taps[i] = (i % 7) * 0.5f; }
+
+	using namespace modm::filter::fir;
+	int offset = 0;
+	unittest::benchmark("fir::dotProductScalar<float,64>", [&]
+	{
+		unittest::doNotOptimize(dotProductScalar<float, N>(taps + offset, coeffs));
+		offset = (offset + 1) % 32;
+	});
+	unittest::benchmark("fir::dotProduct<float,64>", [&]
+	{
+		unittest::doNotOptimize(dotProduct<float, N>(taps + offset, coeffs));
+		offset = (offset + 1) % 32;
+	});
+}
+
+void
+FirTest::benchmarkUpdate()
+{
+	float coeffs[16];
+	for(int i = 0; i < 16; i++) { coeffs[i] = 1.f / (i + 1); }
+	modm::filter::Fir<int16_t, 16, 1, 10> filter(coeffs);
+
+	int16_t value = 0;
+	unittest::benchmark("Fir<int16_t,16>::update", [&]
+	{
+		filter.append(value++);
+		filter.update();
+		unittest::doNotOptimize(filter.getValue());
+	});
+}
+
 /* Length of results array needs to be len(taps) + len(coeff) */
 template<typename T, int N, int BLOCK_SIZE, unsigned int ScaleFactor>
 void FirTest::testFilter(const float (&coeff)[N],
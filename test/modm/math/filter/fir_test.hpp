@@ -23,9 +23,25 @@ public:
 	void
 	testFir();
 
+	void
+	testFirBlock();
+
+	void
+	testDotProduct();
+
+	// Compares the scalar and vectorized kernels
+	void
+	benchmarkDotProduct();
+
+	void
+	benchmarkUpdate();
+
 private:
 	/* Length of results array needs to be len(taps) + len(coeff) */
 	template<typename T, int N, int BLOCK_SIZE, unsigned int ScaleFactor>
 	void testFilter(const float (&coeff)[N],
 		const T taps[], int taps_length, const T results[]);
+
+	template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+	void testBlock(const float (&coeff)[N]);
 };
@@ -75,3 +75,86 @@ LinearInterpolationTest::testInterpolationFlash()
 	TEST_ASSERT_EQUALS(value.interpolate(230), 20000);
 	TEST_ASSERT_EQUALS(value.interpolate(250), 20000);
 }
+
+void
+LinearInterpolationTest::testInterpolationUniform()
+{
+	typedef modm::Pair<int16_t, int16_t> Point;
+
+	Point points[5] =
+	{
+		{ -20, 100 },
+		{   0, 0 },
+		{  20, 40 },
+		{  40, 40 },
+		{  60, -60 }
+	};
+
+	modm::interpolation::Linear<Point> detected(points, 5);
+	modm::interpolation::Linear<Point> declared(points, 5, decltype(declared)::uniform);
+
+	for (int16_t x = -30; x <= 70; x++)
+	{
+		int16_t expected;
+		if (x <= -20)     { expected = 100; }
+		else if (x <= 0)  { expected = -5 * x; }
+		else if (x <= 20) { expected = 2 * x; }
+		else if (x <= 40) { expected = 40; }
+		else if (x <= 60) { expected = 40 - 5 * (x - 40); }
+		else              { expected = -60; }
+
+		TEST_ASSERT_EQUALS(detected.interpolate(x), expected);
+		TEST_ASSERT_EQUALS(declared.interpolate(x), expected);
+	}
+}
+
+void
+LinearInterpolationTest::testInterpolationLarge()
+{
+	typedef modm::Pair<float, float> Point;
+
+	// unevenly spaced, more than 255 points
+	Point points[300];
+	float x = 0;
+	for (uint16_t i = 0; i < 300; i++)
+	{
+		points[i] = {x, 2 * x};
+		x += (i % 3 == 0) ? 0.5f : 1.25f;
+	}
+
+	modm::interpolation::Linear<Point> value(points, 300);
+
+	TEST_ASSERT_EQUALS_DELTA(value.interpolate(-1.f), 0.f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(value.interpolate(0.25f), 0.5f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(value.interpolate(100.f), 200.f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(value.interpolate(298.f), 596.f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(value.interpolate(1000.f), 2 * points[299].getFirst(), 1e-3f);
+
+	// equally spaced, but not exactly representable
+	for (uint16_t i = 0; i < 300; i++) {
+		points[i] = {i * 0.1f, i * 0.3f};
+	}
+	modm::interpolation::Linear<Point> uniform(points, 300);
+	for (uint16_t i = 1; i < 299; i++)
+	{
+		TEST_ASSERT_EQUALS_DELTA(uniform.interpolate(points[i].getFirst()), points[i].getSecond(), 1e-3f);
+		TEST_ASSERT_EQUALS_DELTA(uniform.interpolate(i * 0.1f + 0.05f), i * 0.3f + 0.15f, 1e-3f);
+	}
+}
+
+void
+LinearInterpolationTest::testInterpolationBatch()
+{
+	modm::interpolation::Linear<MyPair, modm::accessor::Flash> \
+		value(modm::accessor::asFlash(flashValues), 6);
+
+	const uint8_t inputs[] = {0, 30, 32, 40, 100, 110, 219, 250, 90, 10, 201, 150};
+	int16_t outputs[12];
+	value.interpolate(inputs, outputs);
+
+	for (uint8_t i = 0; i < 12; i++) {
+		TEST_ASSERT_EQUALS(outputs[i], value.interpolate(inputs[i]));
+	}
+	TEST_ASSERT_EQUALS(outputs[4], 383);
+	TEST_ASSERT_EQUALS(outputs[9], -200);
+}
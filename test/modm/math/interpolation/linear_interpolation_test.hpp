@@ -22,5 +22,14 @@ struct LinearInterpolationTest : public unittest::TestSuite
 
 	void
 	testInterpolationFlash();
+
+	void
+	testInterpolationUniform();
+
+	void
+	testInterpolationLarge();
+
+	void
+	testInterpolationBatch();
 };
 
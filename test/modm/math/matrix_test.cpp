@@ -12,6 +12,7 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/math/matrix.hpp>
+#include <unittest/benchmark.hpp>
 
 #include "matrix_test.hpp"
 
@@ -621,3 +622,21 @@ MatrixTest::testDeterminant()
 	modm::Matrix<int16_t, 1, 1> d = a.subMatrix<1, 1>(1, 1);
 	TEST_ASSERT_EQUALS(d.determinant(), 5);
 }
+
+void
+MatrixTest::benchmarkMultiplication()
+{
+	float m[16];
+	for (uint8_t ii = 0; ii < 16; ++ii) {
+		m[ii] = ii * 0.25f - 2.f;
+	}
+	modm::Matrix<float, 4, 4> a(m);
+	const modm::Matrix<float, 4, 4> b(m);
+
+	unittest::benchmark("Matrix<float,4,4>*", [&]
+	{
+		a = a * b;
+		unittest::doNotOptimize(a);
+		a = b;
+	});
+}
@@ -61,4 +61,7 @@ public:
 
 	void
 	testDeterminant();
+
+	void
+	benchmarkMultiplication();
 };
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/utils/crc.hpp>
+#include <unittest/benchmark.hpp>
+
+#include "crc_test.hpp"
+
+using namespace modm::math;
+
+static const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+template< class Crc >
+static typename Crc::value_type
+checksumBitwise(const uint8_t *data, size_t length)
+{
+	typename Crc::value_type crc{Crc::initial};
+	while (length--) crc = Crc::updateBitwise(crc, *data++);
+	return Crc::finalize(crc);
+}
+
+void
+CrcTest::testCheckValues()
+{
+	// check values of the CRC catalogue for "123456789"
+	TEST_ASSERT_EQUALS(Crc8Maxim::checksum(check, sizeof(check)), 0xA1u);
+	TEST_ASSERT_EQUALS(Crc16Ccitt::checksum(check, sizeof(check)), 0x6F91u);
+	TEST_ASSERT_EQUALS(Crc16Xmodem::checksum(check, sizeof(check)), 0x31C3u);
+	TEST_ASSERT_EQUALS(Crc16Modbus::checksum(check, sizeof(check)), 0x4B37u);
+	TEST_ASSERT_EQUALS(Crc32::checksum(check, sizeof(check)), 0xCBF43926ul);
+	TEST_ASSERT_EQUALS(Crc32c::checksum(check, sizeof(check)), 0xE3069283ul);
+
+	// the tables are computed at compile time
+	static_assert(Crc<32, 0x04C11DB7, false, 0xFFFFFFFF, 0xFFFFFFFF>::updateBitwise(0, 0x01) == 0x04C11DB7ul);
+	TEST_ASSERT_EQUALS((Crc<32, 0x04C11DB7, false, 0xFFFFFFFF, 0xFFFFFFFF>::checksum(check, sizeof(check))), 0xFC891918ul);
+}
+
+void
+CrcTest::testBlockMatchesBytewise()
+{
+	uint8_t data[67];
+	for (size_t ii = 0; ii < sizeof(data); ii++) data[ii] = uint8_t(ii * 97 + 13);
+
+	// all lengths and offsets cover the unrolled blocks and the remainder
+	for (size_t offset = 0; offset < 8; offset++)
+	{
+		const size_t length = sizeof(data) - offset;
+		TEST_ASSERT_EQUALS(Crc8Maxim::checksum(data + offset, length), checksumBitwise<Crc8Maxim>(data + offset, length));
+		TEST_ASSERT_EQUALS(Crc16Ccitt::checksum(data + offset, length), checksumBitwise<Crc16Ccitt>(data + offset, length));
+		TEST_ASSERT_EQUALS(Crc16Xmodem::checksum(data + offset, length), checksumBitwise<Crc16Xmodem>(data + offset, length));
+		TEST_ASSERT_EQUALS(Crc16Modbus::checksum(data + offset, length), checksumBitwise<Crc16Modbus>(data + offset, length));
+		TEST_ASSERT_EQUALS(Crc32::checksum(data + offset, length), checksumBitwise<Crc32>(data + offset, length));
+		TEST_ASSERT_EQUALS(Crc32c::checksum(data + offset, length), checksumBitwise<Crc32c>(data + offset, length));
+	}
+}
+
+void
+CrcTest::testLegacyFunctions()
+{
+	TEST_ASSERT_EQUALS(crc32(check, sizeof(check)), 0xCBF43926ul);
+	TEST_ASSERT_EQUALS(crc16_ccitt(check, sizeof(check)), 0x6F91u);
+
+	uint32_t crc32_value{crc32_init};
+	uint16_t crc16_value{crc16_ccitt_init};
+	for (uint8_t byte : check)
+	{
+		crc32_value = crc32_update(crc32_value, byte);
+		crc16_value = crc16_ccitt_update(crc16_value, byte);
+	}
+	TEST_ASSERT_EQUALS(~crc32_value, 0xCBF43926ul);
+	TEST_ASSERT_EQUALS(crc16_value, 0x6F91u);
+
+	// the CRC-8 of the AMNB protocol header
+	const uint8_t header[] = {6, 12, 0x44, 5, 6, 7, 8};
+#ifdef __AVR__
+	TEST_ASSERT_EQUALS(crc8_ccitt(header, sizeof(header)), 68u);
+#else
+	TEST_ASSERT_EQUALS(crc8_ccitt(header, sizeof(header)), 197u);
+#endif
+}
+
+void
+CrcTest::benchmarkBlock()
+{
+	uint8_t data[256];
+	for (size_t ii = 0; ii < sizeof(data); ++ii) {
+		data[ii] = ii * 7;
+	}
+
+	unittest::benchmark("Crc8Maxim[256]", [&]
+	{ unittest::doNotOptimize(Crc8Maxim::checksum(data, sizeof(data))); });
+	unittest::benchmark("Crc16Ccitt[256]", [&]
+	{ unittest::doNotOptimize(Crc16Ccitt::checksum(data, sizeof(data))); });
+	unittest::benchmark("Crc32[256]", [&]
+	{ unittest::doNotOptimize(Crc32::checksum(data, sizeof(data))); });
+	unittest::benchmark("Crc32c[256]", [&]
+	{ unittest::doNotOptimize(Crc32c::checksum(data, sizeof(data))); });
+}
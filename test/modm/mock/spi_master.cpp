@@ -61,7 +61,7 @@ modm_test::platform::SpiMaster::transfer(uint8_t data)
 }
 
 modm::ResumableResult<void>
-modm_test::platform::SpiMaster::transfer(uint8_t * tx, uint8_t * rx, std::size_t length)
+modm_test::platform::SpiMaster::transfer(const uint8_t * tx, uint8_t * rx, std::size_t length)
 {
 	for(std::size_t i = 0; i < length; ++i) {
 		//if(tx != nullptr)
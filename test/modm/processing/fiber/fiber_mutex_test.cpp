@@ -86,6 +86,47 @@ FiberMutexTest::testMutex()
 	modm::fiber::Scheduler::run();
 }
 
+static void
+f_owner()
+{
+	TEST_ASSERT_EQUALS(state++, 0u);
+	mtx.lock();
+	modm::this_fiber::yield(); // goto 1
+
+	TEST_ASSERT_EQUALS(state++, 3u);
+	mtx.unlock();
+}
+
+static void
+f_waiter1()
+{
+	TEST_ASSERT_EQUALS(state++, 1u);
+	mtx.lock(); // goto 2
+	TEST_ASSERT_EQUALS(state++, 4u);
+	mtx.unlock();
+}
+
+static void
+f_waiter2()
+{
+	TEST_ASSERT_EQUALS(state++, 2u);
+	mtx.lock(); // goto 3
+	TEST_ASSERT_EQUALS(state++, 5u);
+	mtx.unlock();
+}
+
+void
+FiberMutexTest::testMutexQueue()
+{
+	mtx.unlock();
+	// waiting fibers acquire the mutex in the order they started waiting
+	modm::fiber::Task fiber1(stack1, f_owner), fiber2(stack2, f_waiter1), fiber3(stack3, f_waiter2);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 6u);
+	TEST_ASSERT_TRUE(mtx.try_lock());
+	mtx.unlock();
+}
+
 // ============================== RECURSIVE MUTEX =============================
 static modm::fiber::recursive_mutex rc_mtx;
 
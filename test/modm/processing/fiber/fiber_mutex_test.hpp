@@ -23,6 +23,9 @@ public:
 	void
 	testMutex();
 
+	void
+	testMutexQueue();
+
 	void
 	testRecursiveMutex();
 
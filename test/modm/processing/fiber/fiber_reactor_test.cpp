@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "fiber_reactor_test.hpp"
+#include <modm/architecture/detect.hpp>
+
+#ifdef MODM_OS_LINUX
+#include <modm/processing/fiber.hpp>
+#include <cstdio>
+#include <thread>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static modm::fiber::Stack<1 << 14> stack1, stack2;
+static int fds[2];
+static char buffer;
+static size_t state;
+#endif
+
+void
+FiberReactorTest::testWaitReadable()
+{
+#ifdef MODM_OS_LINUX
+	TEST_ASSERT_EQUALS(::pipe(fds), 0);
+	state = 0;
+	modm::fiber::Task reader(stack1, []
+	{
+		TEST_ASSERT_EQUALS(state++, 0u);
+		TEST_ASSERT_TRUE(modm::this_fiber::wait_readable(fds[0]));
+		TEST_ASSERT_EQUALS(state++, 3u);
+		TEST_ASSERT_EQUALS(::read(fds[0], &buffer, 1), 1);
+	}, modm::fiber::Start::Later);
+	modm::fiber::Task writer(stack2, []
+	{
+		TEST_ASSERT_EQUALS(state++, 1u);
+		// the reader is parked and does not run anymore
+		for (int ii = 0; ii < 100; ii++) modm::this_fiber::yield();
+		TEST_ASSERT_EQUALS(state++, 2u);
+		TEST_ASSERT_EQUALS(::write(fds[1], "a", 1), 1);
+	}, modm::fiber::Start::Later);
+
+	reader.start(); writer.start();
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(state, 4u);
+	TEST_ASSERT_EQUALS(buffer, 'a');
+	::close(fds[0]); ::close(fds[1]);
+#endif
+}
+
+void
+FiberReactorTest::testWaitSameDescriptor()
+{
+#ifdef MODM_OS_LINUX
+	TEST_ASSERT_EQUALS(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+	state = 0;
+	modm::fiber::Task reader(stack1, []
+	{
+		TEST_ASSERT_TRUE(modm::this_fiber::wait_readable(fds[0]));
+		TEST_ASSERT_EQUALS(::read(fds[0], &buffer, 1), 1);
+		state++;
+	}, modm::fiber::Start::Later);
+	modm::fiber::Task writer(stack2, []
+	{
+		// both fibers wait on the same file descriptor
+		TEST_ASSERT_TRUE(modm::this_fiber::wait_writable(fds[0]));
+		TEST_ASSERT_EQUALS(::write(fds[0], "b", 1), 1);
+		TEST_ASSERT_TRUE(modm::this_fiber::wait_readable(fds[1]));
+		TEST_ASSERT_EQUALS(::read(fds[1], &buffer, 1), 1);
+		TEST_ASSERT_EQUALS(::write(fds[1], "c", 1), 1);
+		state++;
+	}, modm::fiber::Start::Later);
+
+	reader.start(); writer.start();
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(state, 2u);
+	TEST_ASSERT_EQUALS(buffer, 'c');
+	::close(fds[0]); ::close(fds[1]);
+#endif
+}
+
+void
+FiberReactorTest::testIdleWait()
+{
+#ifdef MODM_OS_LINUX
+	TEST_ASSERT_EQUALS(::pipe(fds), 0);
+	state = 0;
+	modm::fiber::Task reader(stack1, []
+	{
+		// the scheduler blocks in epoll_wait until the thread writes
+		TEST_ASSERT_TRUE(modm::this_fiber::wait_readable(fds[0]));
+		TEST_ASSERT_EQUALS(::read(fds[0], &buffer, 1), 1);
+		state++;
+	}, modm::fiber::Start::Later);
+
+	std::thread thread([]
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		TEST_ASSERT_EQUALS(::write(fds[1], "d", 1), 1);
+	});
+	reader.start();
+	modm::fiber::Scheduler::run();
+	thread.join();
+
+	TEST_ASSERT_EQUALS(state, 1u);
+	TEST_ASSERT_EQUALS(buffer, 'd');
+	::close(fds[0]); ::close(fds[1]);
+#endif
+}
+
+void
+FiberReactorTest::testWaitWithoutScheduler()
+{
+#ifdef MODM_OS_LINUX
+	TEST_ASSERT_EQUALS(::pipe(fds), 0);
+	TEST_ASSERT_TRUE(modm::this_fiber::wait_writable(fds[1]));
+	::close(fds[0]); ::close(fds[1]);
+
+	// regular files cannot be waited on with epoll but are always ready
+	FILE* file = std::tmpfile();
+	modm::fiber::Task task(stack1, [file]
+	{
+		TEST_ASSERT_TRUE(modm::this_fiber::wait_readable(::fileno(file)));
+		TEST_ASSERT_FALSE(modm::this_fiber::wait_readable(-1));
+	});
+	modm::fiber::Scheduler::run();
+	std::fclose(file);
+#endif
+}
@@ -14,6 +14,7 @@
 #include "shared.hpp"
 
 #include <modm-test/mock/clock.hpp>
+#include <unittest/benchmark.hpp>
 
 using namespace std::chrono_literals;
 using test_clock_ms = modm_test::chrono::milli_clock;
@@ -229,6 +230,53 @@ FiberTest::testSleepUntil()
 	runSleepUntil(0xffff'ffff - 30);
 }
 
+static modm::fiber::Stack<1 << 14> sleeper_stacks[5];
+static constexpr uint8_t sleeper_durations[5]{50, 10, 40, 20, 30};
+static uint8_t sleeper_order[5];
+static uint32_t sleeper_start;
+
+static auto
+sleeper(uint8_t index)
+{
+	return [index]
+	{
+		modm::this_fiber::sleep_for(std::chrono::milliseconds(sleeper_durations[index]));
+		const uint32_t elapsed = modm::Clock::now().time_since_epoch().count() - sleeper_start;
+		TEST_ASSERT_TRUE(elapsed >= sleeper_durations[index]);
+		TEST_ASSERT_TRUE(elapsed < sleeper_durations[index] + 5u);
+		sleeper_order[state++] = index;
+	};
+}
+
+void
+FiberTest::testSleepHeap()
+{
+	// wraps around during the test
+	test_clock_ms::setTime(0xffff'ffff - 22);
+	sleeper_start = modm::Clock::now().time_since_epoch().count();
+	uint32_t yields{0};
+	modm::fiber::Task fiber0(sleeper_stacks[0], sleeper(0)), fiber1(sleeper_stacks[1], sleeper(1)),
+					  fiber2(sleeper_stacks[2], sleeper(2)), fiber3(sleeper_stacks[3], sleeper(3)),
+					  fiber4(sleeper_stacks[4], sleeper(4));
+	modm::fiber::Task clock(stack1, [&]
+	{
+		while (state < 5)
+		{
+			test_clock_ms::increment(1);
+			modm::this_fiber::yield();
+			yields++;
+		}
+	});
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(sleeper_order[0], 1u);
+	TEST_ASSERT_EQUALS(sleeper_order[1], 3u);
+	TEST_ASSERT_EQUALS(sleeper_order[2], 4u);
+	TEST_ASSERT_EQUALS(sleeper_order[3], 2u);
+	TEST_ASSERT_EQUALS(sleeper_order[4], 0u);
+	TEST_ASSERT_EQUALS(yields, 50u);
+}
+
 static void
 f8(modm::fiber::stop_token stoken)
 {
@@ -261,3 +309,25 @@ FiberTest::testStopToken()
 	});
 	modm::fiber::Scheduler::run();
 }
+
+// ================================= BENCHMARK ================================
+void
+FiberTest::benchmarkYield()
+{
+	bool done{false};
+	modm::fiber::Task fiber1(stack1, [&]
+	{
+		// every iteration switches to the other fiber and back
+		unittest::benchmark("Fiber::yield*2", []
+		{
+			modm::this_fiber::yield();
+		});
+		done = true;
+	});
+	modm::fiber::Task fiber2(stack2, [&]
+	{
+		while (not done) modm::this_fiber::yield();
+	});
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_TRUE(done);
+}
@@ -41,6 +41,12 @@ public:
 	void
 	testSleepUntil();
 
+	void
+	testSleepHeap();
+
 	void
 	testStopToken();
+
+	void
+	benchmarkYield();
 };
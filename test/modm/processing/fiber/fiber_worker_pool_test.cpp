@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "fiber_worker_pool_test.hpp"
+#include <modm/architecture/detect.hpp>
+
+#ifdef MODM_OS_HOSTED
+#include <modm/processing/fiber.hpp>
+#include <atomic>
+
+static constexpr size_t fibers = 8;
+static constexpr size_t iterations = 100;
+static std::atomic<size_t> started, counter;
+static modm::fiber::Stack<1 << 14> stacks[fibers];
+
+static void
+count()
+{
+	started++;
+	// force the fibers to run concurrently
+	while(started < fibers) modm::this_fiber::yield();
+	for (size_t ii = 0; ii < iterations; ii++)
+	{
+		counter++;
+		modm::this_fiber::yield();
+	}
+}
+#endif
+
+void
+WorkerPoolTest::testWorkerPool()
+{
+#ifdef MODM_OS_HOSTED
+	started = 0; counter = 0;
+	{
+		modm::fiber::Task t0(stacks[0], count), t1(stacks[1], count),
+						  t2(stacks[2], count), t3(stacks[3], count),
+						  t4(stacks[4], count), t5(stacks[5], count),
+						  t6(stacks[6], count), t7(stacks[7], count);
+		modm::fiber::WorkerPool pool;
+		pool.run(4);
+		TEST_ASSERT_FALSE(t0.isRunning());
+		TEST_ASSERT_FALSE(t7.isRunning());
+	}
+	TEST_ASSERT_EQUALS(started.load(), fibers);
+	TEST_ASSERT_EQUALS(counter.load(), fibers * iterations);
+#endif
+}
+
+void
+WorkerPoolTest::testStartFromWorker()
+{
+#ifdef MODM_OS_HOSTED
+	started = 0; counter = 0;
+	{
+		modm::fiber::Task child(stacks[1], []
+		{
+			counter++;
+			modm::this_fiber::yield();
+			counter++;
+		}, modm::fiber::Start::Later);
+		modm::fiber::Task parent(stacks[0], [&]
+		{
+			TEST_ASSERT_TRUE(child.start());
+			child.join();
+			TEST_ASSERT_EQUALS(counter.load(), 2u);
+		});
+		modm::fiber::WorkerPool pool;
+		pool.run(2);
+		TEST_ASSERT_FALSE(parent.isRunning());
+		TEST_ASSERT_FALSE(child.isRunning());
+	}
+	TEST_ASSERT_EQUALS(counter.load(), 2u);
+#endif
+}
+
+void
+WorkerPoolTest::testSingleFiberYield()
+{
+#ifdef MODM_OS_HOSTED
+	modm::fiber::WorkerPool pool;
+	size_t balances{0};
+	{
+		modm::fiber::Task task(stacks[0], [&]
+		{
+			// wait until the other workers have run out of work
+			while (true)
+			{
+				{
+					std::lock_guard lock(pool.mutex);
+					if (pool.waiting == 3)
+					{
+						balances = pool.balances;
+						break;
+					}
+				}
+				modm::this_fiber::yield();
+			}
+			// a single fiber cannot be handed over, so it must not take the lock
+			for (size_t ii = 0; ii < 1000; ii++) modm::this_fiber::yield();
+			std::lock_guard lock(pool.mutex);
+			balances = pool.balances - balances;
+		});
+		pool.run(4);
+		TEST_ASSERT_FALSE(task.isRunning());
+	}
+	TEST_ASSERT_EQUALS(balances, 0u);
+#endif
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, agent
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "monochrome_graphic_display_test.hpp"
+
+#include <modm/ui/display/monochrome_graphic_display_vertical.hpp>
+#include <modm/ui/display/monochrome_graphic_display_horizontal.hpp>
+
+namespace
+{
+
+template< class Display >
+class TestDisplay : public Display
+{
+public:
+	void
+	update() override
+	{
+		this->clearDirty();
+	}
+
+	bool
+	isRowDirty(std::size_t row, std::size_t first, std::size_t last) const
+	{
+		return this->dirty[row].first == first and this->dirty[row].last == last;
+	}
+
+	bool
+	isRowClean(std::size_t row) const
+	{
+		return this->dirty[row].isEmpty();
+	}
+
+	using Display::setPixel;
+	using Display::clearPixel;
+	using Display::drawHorizontalLine;
+	using Display::drawVerticalLine;
+	using Display::isCompletelyDirty;
+};
+
+using Vertical = TestDisplay< modm::MonochromeGraphicDisplayVertical<32, 24> >;
+using Horizontal = TestDisplay< modm::MonochromeGraphicDisplayHorizontal<32, 4> >;
+
+}
+
+// ----------------------------------------------------------------------------
+void
+MonochromeGraphicDisplayTest::testDirtyVertical()
+{
+	Vertical display;
+
+	// the content of the display is unknown at first
+	TEST_ASSERT_TRUE(display.isDirty());
+	TEST_ASSERT_TRUE(display.isCompletelyDirty());
+	display.update();
+	TEST_ASSERT_FALSE(display.isDirty());
+
+	display.setPixel(5, 9);
+	display.setPixel(3, 10);
+	TEST_ASSERT_TRUE(display.isDirty());
+	TEST_ASSERT_FALSE(display.isCompletelyDirty());
+	TEST_ASSERT_TRUE(display.isRowClean(0));
+	TEST_ASSERT_TRUE(display.isRowDirty(1, 3, 5));
+	TEST_ASSERT_TRUE(display.isRowClean(2));
+	display.update();
+
+	// pixels outside of the display are ignored
+	display.setPixel(-1, 0);
+	display.setPixel(32, 0);
+	display.clearPixel(0, 24);
+	TEST_ASSERT_FALSE(display.isDirty());
+
+	display.clearPixel(31, 23);
+	TEST_ASSERT_TRUE(display.isRowDirty(2, 31, 31));
+	display.update();
+
+	display.clear();
+	TEST_ASSERT_TRUE(display.isCompletelyDirty());
+	display.update();
+
+	display.markDirty();
+	TEST_ASSERT_TRUE(display.isCompletelyDirty());
+}
+
+void
+MonochromeGraphicDisplayTest::testDirtyVerticalLines()
+{
+	Vertical display;
+	display.update();
+
+	display.drawHorizontalLine({-4, 12}, 10);
+	TEST_ASSERT_TRUE(display.isRowClean(0));
+	TEST_ASSERT_TRUE(display.isRowDirty(1, 0, 5));
+	TEST_ASSERT_TRUE(display.isRowClean(2));
+	display.update();
+
+	display.drawHorizontalLine({28, 0}, 10);
+	TEST_ASSERT_TRUE(display.isRowDirty(0, 28, 31));
+	display.update();
+
+	display.drawVerticalLine({7, 4}, 8);
+	TEST_ASSERT_TRUE(display.isRowDirty(0, 7, 7));
+	TEST_ASSERT_TRUE(display.isRowDirty(1, 7, 7));
+	TEST_ASSERT_TRUE(display.isRowClean(2));
+	display.update();
+
+	display.drawRectangle({2, 2}, 4, 4);
+	TEST_ASSERT_TRUE(display.isRowDirty(0, 2, 5));
+	TEST_ASSERT_TRUE(display.isRowClean(1));
+	TEST_ASSERT_TRUE(display.isRowClean(2));
+}
+
+void
+MonochromeGraphicDisplayTest::testDirtyHorizontal()
+{
+	Horizontal display;
+	display.update();
+
+	display.setPixel(9, 1);
+	display.setPixel(30, 1);
+	display.clearPixel(0, 3);
+	TEST_ASSERT_TRUE(display.isRowClean(0));
+	TEST_ASSERT_TRUE(display.isRowDirty(1, 1, 3));
+	TEST_ASSERT_TRUE(display.isRowClean(2));
+	TEST_ASSERT_TRUE(display.isRowDirty(3, 0, 0));
+
+	display.update();
+	TEST_ASSERT_FALSE(display.isDirty());
+}
@@ -22,13 +22,14 @@ python3 -m modm_tools.unit_test path/containing/tests path/to/generated_runner.c
 
 Note that the files containing unittests must contain *one* class that inherits
 from the `unittest::TestSuite` class, and test case names must begin with
-`test`:
+`test`, or with `benchmark` for benchmark cases:
 
 ```cpp
 class TestClass : public unittest::TestSuite
 {
 public:
     void testCase1();
+    void benchmarkCase1();
 }
 ```
 """
@@ -54,7 +55,7 @@ namespace
 FLASH_STORAGE_STRING({{test.instance}}Name) = "{{test.file[:-5]}}";
 {%- if functions %}
 {% for test_case in test.test_cases -%}
-FLASH_STORAGE_STRING({{test.instance}}_{{test_case}}Name) = "{{test_case[4:]}}";
+FLASH_STORAGE_STRING({{test.instance}}_{{test_case}}Name) = "{{test_case[4:] if test_case.startswith("test") else test_case}}";
 {% endfor -%}
 {% endif -%}
 {% endfor -%}
@@ -99,7 +100,7 @@ def extract_tests(headers):
         name = name[0]
 
         functions = re.findall(
-            r"void\s+(test[_a-zA-Z]\w*)\s*\([\svoid]*\)\s*;", content)
+            r"void\s+((?:test|benchmark)[_a-zA-Z]\w*)\s*\([\svoid]*\)\s*;", content)
         if not functions:
             print("No tests found in {}!".format(header))
 